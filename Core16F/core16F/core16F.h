@@ -168,6 +168,15 @@
 /******I2C ********************************************************************/
 #ifdef _CORE16F_HAL_I2C_ENABLE
     #include "hal/i2c1/i2c1.h"
+    #ifdef _CORE16F_HAL_I2C1_PRESENCE_ENABLE
+        #include "hal/i2c1/i2c1_presence.h"
+    #endif
+    #ifdef _CORE16F_HAL_I2C1_ASYNC_ENABLE
+        #include "hal/i2c1/i2c1_async.h"
+    #endif
+    #ifdef _CORE16F_HAL_I2C1_TARGET_ENABLE
+        #include "hal/i2c1/i2c1_target.h"
+    #endif
 #endif
 
 /******One Wire ***************************************************************/
@@ -205,6 +214,7 @@ typedef struct {
     uint8_t (*Clear_Bit)(uint8_t byte, uint8_t bit_position);
     void (*FloatToString)(float number, char* buffer, uint8_t decimalPlaces);
     void (*IntToString)(int32_t number, char* buffer);
+    uint8_t (*UintToDigits)(uint32_t number, char* digits);
 }CORE16F_System_Interface_t;
 
 extern const CORE16F_System_Interface_t CORE;
@@ -66,6 +66,7 @@ const CORE16F_System_Interface_t CORE = {
     .Clear_Bit = &CORE_Clear_Bit,
     .FloatToString =&CORE_floatToString,
     .IntToString = &CORE_intToString,
+    .UintToDigits = &CORE_uintToDigits,
 };
 
 /******************************************************************************
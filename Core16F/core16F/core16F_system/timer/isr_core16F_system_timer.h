@@ -33,6 +33,7 @@
 *
 *   Date        Version     Author          Description 
 *   2024/04/25  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  GetMicros
 *  
 *
 *****************************************************************************/
@@ -51,6 +52,7 @@
 void ISR_CORE16F_SYSTEM_TIMER_Init(void);
 void ISR_CORE16F_SYSTEM_TIMER_ISR(void);
 uint32_t ISR_CORE16F_SYSTEM_TIMER_GetMillis(void);
+uint32_t ISR_CORE16F_SYSTEM_TIMER_GetMicros(void);
 
 #endif /*_CORE16F_SYSTEM_TIMER_H*/
 
@@ -75,6 +75,9 @@
 
 /*I2C*/
 //#define _CORE16F_HAL_I2C_ENABLE
+//#define _CORE16F_HAL_I2C1_PRESENCE_ENABLE  //Bus scan and presence cache - 36 bytes of RAM, see I2C1_PRESENCE
+//#define _CORE16F_HAL_I2C1_ASYNC_ENABLE  //Interrupt driven transaction queue
+//#define _CORE16F_HAL_I2C1_TARGET_ENABLE //Register map target instead of host - see I2C1_TARGET
 
 /*One Wire*/
 //#define _CORE16F_HAL_ONE_WIRE_ENABLE
@@ -204,6 +207,7 @@ const PWM_Config_t PWM_Config[]=
 *******************************************************************************/
 #define I2C1_CLOCK_PIN PORTA_0
 #define I2C1_DATA_PIN PORTA_1
+#define _I2C1_BUS_SPEED_HZ 100000UL  //100000 Standard, 400000 Fast-mode, 1000000 Fast-mode Plus
 
 
 /******************************************************************************
@@ -73,6 +73,9 @@ typedef enum
     MAX_IOPINS
 }GPIO_Ports_t;
 
+/*RA3 is input only - MCLR when enabled*/
+#define _CORE16F_GPIO_INPUT_ONLY_PIN PORTA_3
+
 /******************************************************************************
 * GPIO Register Lookup
 *******************************************************************************/
@@ -0,0 +1,107 @@
+/****************************************************************************
+* Title                 :   Serial Command Line Interface
+* Filename              :   cli.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+#ifndef _COREMCU_CLI_H
+#define _COREMCU_CLI_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core_version.h"
+
+#ifdef _CORE16_MCU
+    #include "../../core16F.h"
+#endif
+
+#ifdef _CORE18_MCU
+	#include "../../core18F.h"
+#endif
+
+/******************************************************************************
+* Configuration
+*******************************************************************************/
+#define _CLI_LINE_BUFFER_SIZE 32      //Longest command line including arguments
+#define _CLI_MAX_ARGS 6               //Command name counts as the first argument
+#define _CLI_MAX_BYTES_PER_PROCESS 8  //Caps the time spent in CLI_Process per call
+#define _CLI_ECHO_ENABLE              //Echo typed characters back to the terminal
+#define _CLI_PROMPT "> "
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  CLI_OK,
+  CLI_UNKNOWN_COMMAND,
+  CLI_BAD_ARGUMENT,
+  CLI_TOO_MANY_ARGS,
+  CLI_LINE_OVERFLOW
+}CLI_Status_Enum_t;
+
+/*Command handler - argv[0] is the command name, strings live in the RX line buffer*/
+typedef CLI_Status_Enum_t (*CLI_Handler_t)(uint8_t argc, char *argv[]);
+
+/*Command table entry - declare the table const so it stays in program memory*/
+typedef struct
+{
+  const char *name;
+  CLI_Handler_t handler;
+}CLI_Command_t;
+
+/******************************************************************************
+***** CLI Interface
+*******************************************************************************/
+typedef struct {
+  void (*Initialize)(const CLI_Command_t *command_table, uint8_t command_count);
+  void (*Process)(void);
+  void (*ReceiveByte)(uint8_t data);
+  bool (*ParseInt)(const char *text, int32_t *value);
+}CLI_Interface_t;
+
+extern const CLI_Interface_t CLI;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void CLI_Init(const CLI_Command_t *command_table, uint8_t command_count);
+void CLI_Process(void);
+void CLI_ReceiveByte(uint8_t data);
+bool CLI_ParseInt(const char *text, int32_t *value);
+
+#endif /*_COREMCU_CLI_H*/
+
+/*** End of File **************************************************************/
@@ -0,0 +1,275 @@
+/****************************************************************************
+* Title                 :   24LCxx I2C EEPROM Driver
+* Filename              :   eeprom_24lc.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "eeprom_24lc.h"
+
+/******************************************************************************
+* Interface
+*******************************************************************************/
+const EEPROM_24LC_Interface_t EEPROM_24LC = {
+  .Initialize = &EEPROM_24LC_Init,
+  .Write = &EEPROM_24LC_Write,
+  .Read = &EEPROM_24LC_Read,
+  .WaitReady = &EEPROM_24LC_WaitReady,
+};
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t EEPROM_24LC_Address_Header(const EEPROM_24LC_Device_t *device, uint16_t memory_address, uint8_t *header);
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Status(I2C1_Status_Enum_t i2c_status);
+bool EEPROM_24LC_Present(const EEPROM_24LC_Device_t *device);
+void EEPROM_24LC_Failed(const EEPROM_24LC_Device_t *device);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : EEPROM_24LC_Init()
+* Description: Initializes I2C1 and checks the EEPROM answers its address.
+*
+* Parameters:
+*   - device (const EEPROM_24LC_Device_t*): Part description.
+*
+* Returns:
+*   - EEPROM_24LC_Status_Enum_t: EEPROM_24LC_OK or EEPROM_24LC_INVALID_ADDRESS.
+*
+* Example:
+*   const EEPROM_24LC_Device_t config_store = EEPROM_24LC256(_EEPROM_24LC_BASE_ADDRESS);
+*   EEPROM_24LC.Initialize(&config_store);
+*******************************************************************************/
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Init(const EEPROM_24LC_Device_t *device)
+{
+  I2C1_MASTER.Initialize();
+  
+  return EEPROM_24LC_WaitReady(device);
+}
+
+/******************************************************************************
+* Function : EEPROM_24LC_Write()
+* Description: Writes any length at any address. The data is split at page
+* boundaries - each page is one I2C transaction carrying the memory address
+* and up to page_size bytes, then the part is ACK polled until the internal
+* write is done instead of waiting the worst case 5ms.
+*
+* Parameters:
+*   - device (const EEPROM_24LC_Device_t*): Part description.
+*   - memory_address (uint16_t): First byte to write.
+*   - data (const uint8_t*): Bytes to write.
+*   - length (uint16_t): Number of bytes.
+*
+* Returns:
+*   - EEPROM_24LC_Status_Enum_t
+*
+* Example:
+*   EEPROM_24LC.Write(&config_store, 0x0100, (const uint8_t *)&calibration, sizeof(calibration));
+*******************************************************************************/
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Write(const EEPROM_24LC_Device_t *device, uint16_t memory_address, const uint8_t *data, uint16_t length)
+{
+  I2C1_Segment_t segments[2];
+  uint8_t header[2];
+  uint8_t i2c_address;
+  uint8_t page_space;
+  EEPROM_24LC_Status_Enum_t status;
+  
+  if (((uint32_t)memory_address + length) > device->size){return EEPROM_24LC_OUT_OF_RANGE;}
+  if (!EEPROM_24LC_Present(device)){return EEPROM_24LC_INVALID_ADDRESS;}
+  
+  segments[0].data = header;
+  
+  while (length > 0)
+  {
+      /*Bytes left in this page - a page write wraps inside the page, never across*/
+      page_space = (uint8_t)(device->page_size - (memory_address & (device->page_size - 1)));
+      
+      i2c_address = EEPROM_24LC_Address_Header(device, memory_address, header);
+      segments[0].length = device->address_bytes;
+      segments[1].data = data;
+      segments[1].length = (length < page_space) ? (uint8_t)length : page_space;
+      
+      status = EEPROM_24LC_Status(I2C1_MASTER.WriteVector(i2c_address, segments, 2));
+      if (status != EEPROM_24LC_OK){EEPROM_24LC_Failed(device); return status;}
+      
+      status = EEPROM_24LC_WaitReady(device);
+      if (status != EEPROM_24LC_OK){return (status == EEPROM_24LC_INVALID_ADDRESS) ? EEPROM_24LC_WRITE_TIMEOUT : status;}
+      
+      memory_address += segments[1].length;
+      data += segments[1].length;
+      length -= segments[1].length;
+  }
+  
+  return EEPROM_24LC_OK;
+}
+
+/******************************************************************************
+* Function : EEPROM_24LC_Read()
+* Description: Sequential read of any length. The part increments its own
+* address, so each chunk of up to _EEPROM_24LC_READ_CHUNK bytes is a single
+* transaction - the address is only resent between chunks.
+*
+* Parameters:
+*   - device (const EEPROM_24LC_Device_t*): Part description.
+*   - memory_address (uint16_t): First byte to read.
+*   - data (uint8_t*): Destination.
+*   - length (uint16_t): Number of bytes.
+*
+* Returns:
+*   - EEPROM_24LC_Status_Enum_t
+*******************************************************************************/
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Read(const EEPROM_24LC_Device_t *device, uint16_t memory_address, uint8_t *data, uint16_t length)
+{
+  uint8_t header[2];
+  uint8_t i2c_address;
+  uint8_t chunk;
+  EEPROM_24LC_Status_Enum_t status;
+  
+  if (((uint32_t)memory_address + length) > device->size){return EEPROM_24LC_OUT_OF_RANGE;}
+  if (!EEPROM_24LC_Present(device)){return EEPROM_24LC_INVALID_ADDRESS;}
+  
+  while (length > 0)
+  {
+      chunk = (length < _EEPROM_24LC_READ_CHUNK) ? (uint8_t)length : _EEPROM_24LC_READ_CHUNK;
+      
+      /*One address byte parts switch block at 256 bytes - keep a chunk inside its block*/
+      if ((device->address_bytes == 1) && (((memory_address & 0xFF) + chunk) > 0x100)) {
+          chunk = (uint8_t)(0x100 - (memory_address & 0xFF));
+      }
+      
+      i2c_address = EEPROM_24LC_Address_Header(device, memory_address, header);
+      status = EEPROM_24LC_Status(I2C1_MASTER.ReadData(i2c_address, device->address_bytes, header, chunk, data));
+      if (status != EEPROM_24LC_OK){EEPROM_24LC_Failed(device); return status;}
+      
+      memory_address += chunk;
+      data += chunk;
+      length -= chunk;
+  }
+  
+  return EEPROM_24LC_OK;
+}
+
+/******************************************************************************
+* Function : EEPROM_24LC_WaitReady()
+* Description: ACK polling - the part ignores its address until an internal
+* write cycle is finished, so the first ACK means it is ready. Busy polls show
+* up as address NACKs in the I2C1 statistics.
+*
+* Returns:
+*   - EEPROM_24LC_Status_Enum_t: EEPROM_24LC_OK once the part answers,
+*     EEPROM_24LC_INVALID_ADDRESS if it never does.
+*******************************************************************************/
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_WaitReady(const EEPROM_24LC_Device_t *device)
+{
+  uint8_t unused = 0;
+  I2C1_Status_Enum_t i2c_status;
+  
+  for (uint8_t poll = 0; poll < _EEPROM_24LC_POLL_LIMIT; poll++)
+  {
+      i2c_status = I2C1_MASTER.WriteData(device->i2c_address, 0, &unused);
+      if (i2c_status != I2C_ADDRESS_INVALID){return EEPROM_24LC_Status(i2c_status);}
+      __delay_us(_EEPROM_24LC_POLL_DELAY_US);
+  }
+  
+  return EEPROM_24LC_INVALID_ADDRESS;
+}
+
+/******************************************************************************
+* Function : EEPROM_24LC_Address_Header()
+* Description: Fills header with the memory address bytes and returns the I2C
+* address to use - block select bits included for one address byte parts.
+*
+*******************************************************************************/
+uint8_t EEPROM_24LC_Address_Header(const EEPROM_24LC_Device_t *device, uint16_t memory_address, uint8_t *header)
+{
+  if (device->address_bytes == 1) {
+      header[0] = (uint8_t)memory_address;
+      return (uint8_t)(device->i2c_address | ((memory_address >> 8) & 0x07));
+  }
+  
+  header[0] = (uint8_t)(memory_address >> 8);
+  header[1] = (uint8_t)memory_address;
+  return device->i2c_address;
+}
+
+/******************************************************************************
+* Function : EEPROM_24LC_Status()
+* Description: Maps an I2C1 status to the driver status.
+*
+*******************************************************************************/
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Status(I2C1_Status_Enum_t i2c_status)
+{
+  if (i2c_status == I2C_OK){return EEPROM_24LC_OK;}
+  if (i2c_status == I2C_ADDRESS_INVALID){return EEPROM_24LC_INVALID_ADDRESS;}
+  return EEPROM_24LC_GENERIC_ERROR;
+}
+
+/******************************************************************************
+* Function : EEPROM_24LC_Present()
+* Description: Cached presence check ahead of a transfer - always true without
+* the I2C1 presence cache.
+*
+*******************************************************************************/
+bool EEPROM_24LC_Present(const EEPROM_24LC_Device_t *device)
+{
+#ifdef _EEPROM_24LC_PRESENCE
+  return I2C1_PRESENCE.IsPresent(device->i2c_address);
+#else
+  return true;
+#endif
+}
+
+/******************************************************************************
+* Function : EEPROM_24LC_Failed()
+* Description: A transfer failed - drops the cache entry so the next transfer
+* probes again. ACK polling does not come here, a busy part NACKs by design.
+* The entry is the device's base address, the one EEPROM_24LC_Present()
+* checks, not the block-select address the transfer used.
+*
+*******************************************************************************/
+void EEPROM_24LC_Failed(const EEPROM_24LC_Device_t *device)
+{
+#ifdef _EEPROM_24LC_PRESENCE
+  I2C1_PRESENCE.Invalidate(device->i2c_address);
+#endif
+}
+
+
+/*** End of File **************************************************************/
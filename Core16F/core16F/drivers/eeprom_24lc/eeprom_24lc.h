@@ -0,0 +1,118 @@
+/****************************************************************************
+* Title                 :   24LCxx I2C EEPROM Driver
+* Filename              :   eeprom_24lc.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+#ifndef _COREMCU_EEPROM_24LC_H
+#define _COREMCU_EEPROM_24LC_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core_version.h"
+
+#ifdef _CORE16_MCU
+    #include "../../core16F.h"
+#endif
+
+#ifdef _CORE18_MCU
+	#include "../../core18F.h"
+#endif
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+#define _EEPROM_24LC_BASE_ADDRESS 0x50    //A2..A0 tied low
+#define _EEPROM_24LC_POLL_LIMIT 100       //ACK polls before a page write is declared stuck
+#define _EEPROM_24LC_POLL_DELAY_US 100    //Between polls - 100 polls covers the 5ms tWC with margin
+#define _EEPROM_24LC_READ_CHUNK 128       //Largest single I2C read, ReadData counts in 8 bits
+
+#if defined(_CORE16F_HAL_I2C1_PRESENCE_ENABLE) || defined(_CORE18F_HAL_I2C1_PRESENCE_ENABLE)
+    #define _EEPROM_24LC_PRESENCE   //Transfers skip a part the presence cache knows is missing
+#endif
+
+/*Common parts - page size, address bytes, size in bytes*/
+#define EEPROM_24LC02(i2c_address)  {i2c_address, 8, 1, 256UL}
+#define EEPROM_24LC16(i2c_address)  {i2c_address, 16, 1, 2048UL}
+#define EEPROM_24LC64(i2c_address)  {i2c_address, 32, 2, 8192UL}
+#define EEPROM_24LC256(i2c_address) {i2c_address, 64, 2, 32768UL}
+#define EEPROM_24LC512(i2c_address) {i2c_address, 128, 2, 65536UL}
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  EEPROM_24LC_OK,
+  EEPROM_24LC_GENERIC_ERROR,
+  EEPROM_24LC_INVALID_ADDRESS,
+  EEPROM_24LC_OUT_OF_RANGE,
+  EEPROM_24LC_WRITE_TIMEOUT
+}EEPROM_24LC_Status_Enum_t;
+
+/*Parts with one address byte and more than 256 bytes (24LC04/08/16) carry
+ *the upper memory address bits in the I2C address - handled by the driver*/
+typedef struct
+{
+  uint8_t i2c_address;      //7-bit
+  uint8_t page_size;        //Power of 2
+  uint8_t address_bytes;    //1 or 2
+  uint32_t size;            //Bytes
+}EEPROM_24LC_Device_t;
+
+/******************************************************************************
+***** EEPROM_24LC Interface
+*******************************************************************************/
+typedef struct {
+  EEPROM_24LC_Status_Enum_t (*Initialize)(const EEPROM_24LC_Device_t *device);
+  EEPROM_24LC_Status_Enum_t (*Write)(const EEPROM_24LC_Device_t *device, uint16_t memory_address, const uint8_t *data, uint16_t length);
+  EEPROM_24LC_Status_Enum_t (*Read)(const EEPROM_24LC_Device_t *device, uint16_t memory_address, uint8_t *data, uint16_t length);
+  EEPROM_24LC_Status_Enum_t (*WaitReady)(const EEPROM_24LC_Device_t *device);
+}EEPROM_24LC_Interface_t;
+
+extern const EEPROM_24LC_Interface_t EEPROM_24LC;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Init(const EEPROM_24LC_Device_t *device);
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Write(const EEPROM_24LC_Device_t *device, uint16_t memory_address, const uint8_t *data, uint16_t length);
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_Read(const EEPROM_24LC_Device_t *device, uint16_t memory_address, uint8_t *data, uint16_t length);
+EEPROM_24LC_Status_Enum_t EEPROM_24LC_WaitReady(const EEPROM_24LC_Device_t *device);
+
+#endif /*_COREMCU_EEPROM_24LC_H*/
+
+/*** End of File **************************************************************/
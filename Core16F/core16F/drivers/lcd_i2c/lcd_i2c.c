@@ -3,7 +3,7 @@
 * Filename              :   lcd_i2c.c
 * Author                :   Jamie Starling
 * Origin Date           :   2024/10/15
-* Version               :   1.0.2
+* Version               :   1.7.0
 * Compiler              :   XC8
 * Target                :    
 * Copyright             :   Jamie Starling
@@ -35,6 +35,14 @@
 *   2024/10/16  1.0.0   Jamie Starling  Initial Version
 *   2024/10/26  1.0.1   Jamie Starling  Various Timing Fixes after Initialize and Clear 
 *   2024/11/03  1.0.2   Jamie Starling  Changed to use new I2C API 
+*   2026/10/18  1.0.3   Jamie Starling  Address check through the I2C1 presence cache
+*   2026/10/18  1.1.0   Jamie Starling  Stream mode - one I2C write per string instead of six per character
+*   2026/10/18  1.2.0   Jamie Starling  Shadow framebuffer with dirty cell Flush
+*   2026/10/18  1.3.0   Jamie Starling  Background refresh - framebuffer fed to the display a slice at a time
+*   2026/10/18  1.4.0   Jamie Starling  Busy flag polling with fixed delay fallback
+*   2026/10/18  1.5.0   Jamie Starling  Multiple displays - state, geometry and framebuffer per LCD_I2C_Device_t
+*   2026/10/18  1.6.0   Jamie Starling  CGRAM glyph cache with least recently used replacement
+*   2026/10/18  1.7.0   Jamie Starling  Right aligned integer, fixed point and hex fields
 *******************************************************************************/
 
 /******************************************************************************
@@ -51,51 +59,158 @@ const LCD_I2C_Interface_t LCD = {
   .Location = &LCD_I2C_Location,
   .Clear = &LCD_I2C_Clear_Display,
   .Write_Character = &LCD_I2C_Write_Character,
-  .Write = &LCD_I2C_Write_String          
+  .Write = &LCD_I2C_Write_String,
+  #ifdef _LCD_FRAMEBUFFER_ENABLE
+    .Frame_Clear = &LCD_I2C_Frame_Clear,
+    .Frame_Write = &LCD_I2C_Frame_Write,
+    .Frame_Character = &LCD_I2C_Frame_Character,
+    .Frame_Invalidate = &LCD_I2C_Frame_Invalidate,
+    .Flush = &LCD_I2C_Flush,
+  #endif
+  #ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+    .Refresh_Start = &LCD_I2C_Refresh_Start,
+    .Refresh_Stop = &LCD_I2C_Refresh_Stop,
+    .Refresh_IsIdle = &LCD_I2C_Refresh_IsIdle,
+  #endif
+  #ifdef _LCD_GLYPH_CACHE_ENABLE
+    .Glyph = &LCD_I2C_Glyph,
+    .Write_Glyph = &LCD_I2C_Write_Glyph,
+    #ifdef _LCD_FRAMEBUFFER_ENABLE
+      .Frame_Glyph = &LCD_I2C_Frame_Glyph,
+    #endif
+  #endif
+  #ifdef _LCD_FIELDS_ENABLE
+    .Write_Int = &LCD_I2C_Write_Int,
+    .Write_Fixed = &LCD_I2C_Write_Fixed,
+    .Write_Hex = &LCD_I2C_Write_Hex,
+    #ifdef _LCD_FRAMEBUFFER_ENABLE
+      .Frame_Int = &LCD_I2C_Frame_Int,
+      .Frame_Fixed = &LCD_I2C_Frame_Fixed,
+      .Frame_Hex = &LCD_I2C_Frame_Hex,
+    #endif
+  #endif
 };
 
 /******************************************************************************
 * Variables 
 *******************************************************************************/
-LCD_DATA_ByteAccess LCD_Data;
+#ifdef _LCD_STREAM_ENABLE
+uint8_t LCD_Stream_Buffer[_LCD_STREAM_BUFFER_SIZE];   //Shared - every stream is sent before the call that built it returns
+uint8_t LCD_Stream_Count;
+#endif
+
+#ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+LCD_I2C_Device_t *LCD_Refresh_List[_LCD_REFRESH_MAX_DISPLAYS];   //Displays being refreshed, NULL for a free slot
+uint8_t LCD_Refresh_Next;                                         //Slot the next slice starts looking from
+#ifdef _LCD_I2C_ASYNC
+I2C1_Transaction_t LCD_Refresh_Transaction;
+uint8_t LCD_Refresh_Buffer[_LCD_STREAM_BUFFER_SIZE];              //Slice on the bus - leaves the stream buffer free for direct writes
+LCD_I2C_Device_t *LCD_Refresh_Sending;                            //Display the slice on the bus belongs to
+#endif
+#endif
 
 
 /******************************************************************************
 * Function Prototypes
 *******************************************************************************/
 void LCD_I2C_Check_BUS_Status(void);
-LCD_I2C_Status_Enum_t LCD_I2C_Send(uint8_t address, bool RS, uint8_t data);
+LCD_I2C_Status_Enum_t LCD_I2C_Send(LCD_I2C_Device_t *lcd, bool RS, uint8_t data);
+LCD_I2C_Status_Enum_t LCD_I2C_Bus_Write(LCD_I2C_Device_t *lcd, uint8_t length, uint8_t *data);
 LCD_I2C_Status_Enum_t LCD_I2C_Check_Address(uint8_t address);
-LCD_I2C_Status_Enum_t LCD_I2C_Start_LCD_Init_4bitMode(uint8_t address);
+LCD_I2C_Status_Enum_t LCD_I2C_Start_LCD_Init_4bitMode(LCD_I2C_Device_t *lcd);
+LCD_I2C_Status_Enum_t LCD_I2C_Wait_Ready(LCD_I2C_Device_t *lcd, uint8_t fallback_ms);
+void LCD_I2C_Send_Delay(LCD_I2C_Device_t *lcd);
+#ifdef _LCD_BUSY_FLAG_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Read_Busy(LCD_I2C_Device_t *lcd, bool *busy);
+#endif
+#ifdef _LCD_STREAM_ENABLE
+uint8_t LCD_I2C_Stream_Pack(LCD_I2C_Device_t *lcd, uint8_t *stream, uint8_t count, uint8_t data);
+#endif
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+bool LCD_I2C_Frame_Dirty(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column);
+LCD_I2C_Status_Enum_t LCD_I2C_Flush_Row(LCD_I2C_Device_t *lcd, uint8_t row);
+#endif
+#ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+void LCD_I2C_Refresh_Fill(LCD_I2C_Device_t *lcd);
+void LCD_I2C_Refresh_Send(LCD_I2C_Device_t *lcd);
+#ifdef _LCD_I2C_ASYNC
+void LCD_I2C_Refresh_Done(I2C1_Transaction_t *transaction);
+#endif
+#endif
+#ifdef _LCD_GLYPH_CACHE_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Glyph_Load(LCD_I2C_Device_t *lcd, const uint8_t *pattern, uint8_t *character, bool *uploaded);
+LCD_I2C_Status_Enum_t LCD_I2C_Glyph_End(LCD_I2C_Device_t *lcd, const uint8_t *pattern, uint8_t character, bool uploaded);
+uint8_t LCD_I2C_Glyph_Victim(LCD_I2C_Device_t *lcd);
+void LCD_I2C_Glyph_Touch(LCD_I2C_Device_t *lcd, uint8_t slot);
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+bool LCD_I2C_Glyph_On_Frame(LCD_I2C_Device_t *lcd, uint8_t slot);
+#endif
+#endif
+#ifdef _LCD_FIELDS_ENABLE
+bool LCD_I2C_Field_Fits(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width);
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Field(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *field, uint8_t width);
+void LCD_I2C_Format_Fixed(uint8_t *field, uint8_t width, int32_t value, uint8_t decimals);
+void LCD_I2C_Format_Hex(uint8_t *field, uint8_t width, uint32_t value);
+#endif
+
 /******************************************************************************
 * Functions
 *******************************************************************************/
 
 /******************************************************************************
 * Function : LCD_I2C_init()
-* Description: Initializes the I2C communication for an LCD module at a given address. 
-* It sets up the LCD data structure, initializes the I2C module, checks the address, 
-* and starts the LCD in 4-bit mode.
+* Description: Initializes the I2C communication for an LCD module. 
+* It clears the display's control state, initializes the I2C module, checks
+* the address, and starts the LCD in 4-bit mode.
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display - address and geometry filled in, see LCD_I2C_2004().
 * @return LCD_I2C_Status_Enum_t - Status of the initialization.
+*
+* Example:
+*   LCD_I2C_Device_t Panel_Left = LCD_I2C_2004(0x27);
+*   LCD_I2C_Device_t Panel_Right = LCD_I2C_1602(0x26);
+*   LCD.Initialize(&Panel_Left);
+*   LCD.Initialize(&Panel_Right);
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_init(uint8_t address)
+LCD_I2C_Status_Enum_t LCD_I2C_init(LCD_I2C_Device_t *lcd)
 {  
+  // Geometry has to fit the line offsets (and the framebuffer)
+  if ((lcd->rows == 0) || (lcd->rows > _LCD_MAX_ROWS) || (lcd->columns == 0)){return LCD_I2C_GENERIC_ERROR;}
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+  if ((lcd->rows > _LCD_ROWS) || (lcd->columns > _LCD_COLUMNS)){return LCD_I2C_GENERIC_ERROR;}
+  lcd->glass_valid = false;
+#endif
+  
   //Clear the LCD Data Structure
-  LCD_Data.byte = 0x00;
+  lcd->data.byte = 0x00;
+  
+#ifdef _LCD_BUSY_FLAG_ENABLE
+  lcd->busy_flag_usable = false;  // No busy flag until 4-bit mode is set up
+#endif
+  
+#ifdef _LCD_GLYPH_CACHE_ENABLE
+  // CGRAM holds nothing known after power up
+  for (uint8_t slot = 0; slot < _LCD_CGRAM_SLOTS; slot++) {
+    lcd->glyph[slot] = NULL;
+    lcd->glyph_age[slot] = slot;
+    }
+#endif
   
   //Initialize I2C 
   I2C1_MASTER.Initialize(); 
   
   // Check if the provided I2C address is valid
-  if (I2C1_MASTER.WriteData(address,0,&LCD_Data.byte) != I2C_OK){return LCD_I2C_INVALID_ADDRESS;}  
+#ifdef _LCD_I2C_PRESENCE
+  if (!I2C1_PRESENCE.IsPresent(lcd->address)){return LCD_I2C_INVALID_ADDRESS;}  // Only probes if the cache has no answer
+#else
+  if (I2C1_MASTER.WriteData(lcd->address,0,&lcd->data.byte) != I2C_OK){return LCD_I2C_INVALID_ADDRESS;}
+#endif
   
   // Start LCD initialization in 4-bit mode and check for errors
-  if (LCD_I2C_Start_LCD_Init_4bitMode(address) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}  
+  if (LCD_I2C_Start_LCD_Init_4bitMode(lcd) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}  
   
   // Initial delay to allow LCD setup
-  __delay_ms(_LCD_INIT_DELAY_MS);  
+  if (LCD_I2C_Wait_Ready(lcd,_LCD_INIT_DELAY_MS) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
   
   return LCD_I2C_OK;  
 }
@@ -106,51 +221,58 @@ LCD_I2C_Status_Enum_t LCD_I2C_init(uint8_t address)
 * Description: Initializes the LCD module in 4-bit mode using the I2C interface.
 * Sends the initialization sequence commands to configure the LCD.
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display.
 * @return LCD_I2C_Status_Enum_t - Status of the initialization.
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_Start_LCD_Init_4bitMode(uint8_t address)
+LCD_I2C_Status_Enum_t LCD_I2C_Start_LCD_Init_4bitMode(LCD_I2C_Device_t *lcd)
 {
     LCD_I2C_Status_Enum_t LCD_Status; 
     
     // Send the first part of the 4-bit initialization sequence
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(_LCD_CMD_4bit_Mode_1));  
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.High4(_LCD_CMD_4bit_Mode_1));  
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_4bit_Mode_1));
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_4bit_Mode_1));
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
     // Send the second part of the 4-bit initialization sequence
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(_LCD_CMD_4bit_Mode_2));
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.High4(_LCD_CMD_4bit_Mode_2));
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_4bit_Mode_2));
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_4bit_Mode_2));
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
     // Delay to allow the LCD to process the command
     __delay_ms(_LCD_INIT_DELAY_MS);
     
     // Set function mode
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(_LCD_CMD_Function_Set));
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.High4(_LCD_CMD_Function_Set));
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_Function_Set)); 
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_Function_Set)); 
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
-    // Delay to allow the LCD to process the command
-    __delay_ms(_LCD_INIT_DELAY_MS);
+#ifdef _LCD_BUSY_FLAG_ENABLE
+    // 4-bit mode from here on - the busy flag can be read
+    lcd->busy_flag_usable = true;
+#endif
+    
+    // Wait for the LCD to process the command
+    LCD_Status = LCD_I2C_Wait_Ready(lcd,_LCD_INIT_DELAY_MS);
+    if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
   
     // Set display mode
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(_LCD_CMD_Display_Set));
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.High4(_LCD_CMD_Display_Set));
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
-    LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_Display_Set)); 
+    LCD_Status = LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_Display_Set)); 
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
-    // Delay to allow the LCD to process the command
-    __delay_ms(_LCD_INIT_DELAY_MS); 
+    // Wait for the LCD to process the command
+    LCD_Status = LCD_I2C_Wait_Ready(lcd,_LCD_INIT_DELAY_MS);
+    if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
     // Clear the display
-    LCD_Status = LCD_I2C_Clear_Display(address);
+    LCD_Status = LCD_I2C_Clear_Display(lcd);
     if (LCD_Status != LCD_I2C_OK) {return LCD_Status;}
     
     return LCD_I2C_OK;
@@ -162,51 +284,173 @@ LCD_I2C_Status_Enum_t LCD_I2C_Start_LCD_Init_4bitMode(uint8_t address)
 * Description: Sends data or a command to the LCD over I2C. The RS bit determines if the data
 * is a command (RS = 0) or data (RS = 1).
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display.
 * @param RS - Boolean value; true for data, false for command.
 * @param data - The data byte to send.
 *
 * @return LCD_I2C_Status_Enum_t - Status of the transmission.
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_Send(uint8_t address, bool RS, uint8_t data)
+LCD_I2C_Status_Enum_t LCD_I2C_Send(LCD_I2C_Device_t *lcd, bool RS, uint8_t data)
 {  
-  LCD_Data.bits.LCD_DATA = data;
-  LCD_Data.bits.RS = RS;  //Set RS 
+  lcd->data.bits.LCD_DATA = data;
+  lcd->data.bits.RS = RS;  //Set RS 
   
   // First pass with EN Low 
-  __delay_us(_LCD_DATA_DELAY_US);
-  LCD_Data.bits.EN = LOW;
-  if (I2C1_MASTER.WriteData(address,1,&LCD_Data.byte) != I2C_OK){ return LCD_I2C_GENERIC_ERROR; }
+  LCD_I2C_Send_Delay(lcd);
+  lcd->data.bits.EN = LOW;
+  if (LCD_I2C_Bus_Write(lcd,1,&lcd->data.byte) != LCD_I2C_OK){ return LCD_I2C_GENERIC_ERROR; }
 
   // Second pass with EN High
-   __delay_us(_LCD_DATA_DELAY_US);
-  LCD_Data.bits.EN = HIGH;
-  if (I2C1_MASTER.WriteData(address,1,&LCD_Data.byte) != I2C_OK) { return LCD_I2C_GENERIC_ERROR; }
+  LCD_I2C_Send_Delay(lcd);
+  lcd->data.bits.EN = HIGH;
+  if (LCD_I2C_Bus_Write(lcd,1,&lcd->data.byte) != LCD_I2C_OK) { return LCD_I2C_GENERIC_ERROR; }
 
   // Third pass with EN Low again
-   __delay_us(_LCD_DATA_DELAY_US);
-  LCD_Data.bits.EN = LOW;
-  if (I2C1_MASTER.WriteData(address,1,&LCD_Data.byte) != I2C_OK) { return LCD_I2C_GENERIC_ERROR; }  
+  LCD_I2C_Send_Delay(lcd);
+  lcd->data.bits.EN = LOW;
+  if (LCD_I2C_Bus_Write(lcd,1,&lcd->data.byte) != LCD_I2C_OK) { return LCD_I2C_GENERIC_ERROR; }  
   return LCD_I2C_OK;  
 }
 
+/******************************************************************************
+* Function : LCD_I2C_Bus_Write()
+* Description: Every write to the PCF8574 goes through here. With the I2C1
+* presence cache a display known to be missing is skipped without touching the
+* bus - a plain cache lookup, this runs per byte - and a failed write drops
+* its cache entry so the write after it goes on the bus again.
+*
+* @param lcd - The display.
+* @param length - Number of bytes.
+* @param data - Bytes to write.
+*
+* @return LCD_I2C_Status_Enum_t - LCD_I2C_INVALID_ADDRESS if the display is
+* missing, LCD_I2C_GENERIC_ERROR if the write failed.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Bus_Write(LCD_I2C_Device_t *lcd, uint8_t length, uint8_t *data)
+{
+#ifdef _LCD_I2C_PRESENCE
+  if (I2C1_PRESENCE.IsMissing(lcd->address)){return LCD_I2C_INVALID_ADDRESS;}
+#endif
+  
+  if (I2C1_MASTER.WriteData(lcd->address,length,data) != I2C_OK) {
+#ifdef _LCD_I2C_PRESENCE
+    I2C1_PRESENCE.Invalidate(lcd->address);
+#endif
+    return LCD_I2C_GENERIC_ERROR;
+    }
+  return LCD_I2C_OK;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Send_Delay()
+* Description: The fixed delay ahead of each LCD_I2C_Send pass. Skipped once
+* the busy flag is in use - readiness is checked after the whole byte instead.
+*
+*******************************************************************************/
+void LCD_I2C_Send_Delay(LCD_I2C_Device_t *lcd)
+{
+#ifdef _LCD_BUSY_FLAG_ENABLE
+  if (lcd->busy_flag_usable){return;}
+#endif
+  __delay_us(_LCD_DATA_DELAY_US);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Wait_Ready()
+* Description: Waits until the LCD has finished the last command. Polls the busy
+* flag when it is enabled and usable, otherwise waits fallback_ms.
+*
+* @param lcd - The display.
+* @param fallback_ms - Fixed wait used without the busy flag.
+*
+* @return LCD_I2C_Status_Enum_t - Status of the busy flag reads.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Wait_Ready(LCD_I2C_Device_t *lcd, uint8_t fallback_ms)
+{
+#ifdef _LCD_BUSY_FLAG_ENABLE
+  bool busy;
+  
+  if (lcd->busy_flag_usable) {
+    for (uint8_t poll = 0; poll < _LCD_BUSY_POLL_LIMIT; poll++) {
+      if (LCD_I2C_Read_Busy(lcd, &busy) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+      if (!busy){return LCD_I2C_OK;}
+      }
+    lcd->busy_flag_usable = false;  // Never came ready - RW is not wired, fixed delays from now on
+    }
+#endif
+  
+  for (uint8_t ms = 0; ms < fallback_ms; ms++){__delay_ms(1);}
+  return LCD_I2C_OK;
+}
+
+#ifdef _LCD_BUSY_FLAG_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Read_Busy()
+* Description: Reads the busy flag - RW high with D4-D7 released, EN high and
+* the PCF8574 port read (D7 is the flag), then the low nibble is clocked out
+* unread. Three I2C transfers.
+*
+* @param lcd - The display.
+* @param busy - Set true while the controller is busy.
+*
+* @return LCD_I2C_Status_Enum_t - Status of the transfers.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Read_Busy(LCD_I2C_Device_t *lcd, bool *busy)
+{
+  uint8_t sequence[3];
+  uint8_t port;
+  
+  lcd->data.bits.RS = _LCD_RS_CMD;
+  lcd->data.bits.RW = 1;
+  lcd->data.bits.LCD_DATA = 0x0F;  // PCF8574 pins high are inputs
+  
+  // RW settles with EN low, then EN high - the LCD drives the high nibble
+  lcd->data.bits.EN = LOW;
+  sequence[0] = lcd->data.byte;
+  lcd->data.bits.EN = HIGH;
+  sequence[1] = lcd->data.byte;
+  if (LCD_I2C_Bus_Write(lcd,2,sequence) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  
+  if (I2C1_MASTER.ReadData(lcd->address,0,NULL,1,&port) != I2C_OK) {
+#ifdef _LCD_I2C_PRESENCE
+    I2C1_PRESENCE.Invalidate(lcd->address);
+#endif
+    return LCD_I2C_GENERIC_ERROR;
+    }
+  
+  // Finish the read with the low nibble so the LCD stays in step
+  lcd->data.bits.EN = LOW;
+  sequence[0] = lcd->data.byte;
+  lcd->data.bits.EN = HIGH;
+  sequence[1] = lcd->data.byte;
+  lcd->data.bits.EN = LOW;
+  sequence[2] = lcd->data.byte;
+  if (LCD_I2C_Bus_Write(lcd,3,sequence) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  
+  lcd->data.bits.RW = 0;
+  lcd->data.bits.LCD_DATA = 0x00;
+  *busy = ((port & 0x80) != 0);
+  return LCD_I2C_OK;
+}
+#endif
+
 /******************************************************************************
 * Function : LCD_I2C_BackLight()
 * Description: Controls the LCD backlight state (on or off).
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display.
 * @param set_light - The desired state of the backlight (ON or OFF).
 * 
 * @return LCD_I2C_Status_Enum_t - Status of the transmission.
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_BackLight(uint8_t address, LogicEnum_t set_light)
+LCD_I2C_Status_Enum_t LCD_I2C_BackLight(LCD_I2C_Device_t *lcd, LogicEnum_t set_light)
 {  
   // Set backlight bit based on the input state
-  LCD_Data.bits.BackLight = (set_light == ON) ? 1 : 0;    
-  LCD_Data.bits.LCD_DATA = 0x00;  // Clear data bits if not needed for backlight control
+  lcd->data.bits.BackLight = (set_light == ON) ? 1 : 0;    
+  lcd->data.bits.LCD_DATA = 0x00;  // Clear data bits if not needed for backlight control
   
   // Write to the LCD and check for errors
-  if (I2C1_MASTER.WriteData(address,1,&LCD_Data.byte) != I2C_OK){return LCD_I2C_GENERIC_ERROR;}    
+  if (LCD_I2C_Bus_Write(lcd,1,&lcd->data.byte) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}    
   return LCD_I2C_OK;  
 }
 
@@ -214,30 +458,32 @@ LCD_I2C_Status_Enum_t LCD_I2C_BackLight(uint8_t address, LogicEnum_t set_light)
 * Function : LCD_I2C_Location()
 * Description: Sets the cursor position on the LCD display.
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display.
 * @param row - The row number (0-based index).
 * @param column - The column number (0-based index).
 *
 *  @return LCD_I2C_Status_Enum_t - Status of the transmission.
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_Location(uint8_t address, uint8_t row, uint8_t column)
+LCD_I2C_Status_Enum_t LCD_I2C_Location(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column)
 {
   uint8_t location_data;  
   
   // Determine the starting address based on the row
-  switch (row) {
-        case 0: location_data = _LCD_LINE_1 + column; break;  // Line 1
-        case 1: location_data = _LCD_LINE_2 + column; break;  // Line 2
-        case 2: location_data = _LCD_LINE_3 + column; break;  // Line 3 (for 4-line displays)
-        case 3: location_data = _LCD_LINE_4 + column; break;  // Line 4 (for 4-line displays)
-        default: return LCD_I2C_GENERIC_ERROR;  // Invalid row
-    }
+  if (row >= lcd->rows){return LCD_I2C_GENERIC_ERROR;}  // Invalid row
+  location_data = lcd->line_offset[row] + column;
   
   // Combine with the command for setting the DDRAM address
   location_data = (0x80 | location_data);
   
-  if(LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(location_data)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
-  if(LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(location_data)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+#ifdef _LCD_STREAM_ENABLE
+  if(LCD_I2C_Stream(lcd,_LCD_RS_CMD,&location_data,1) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+#else
+  if(LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.High4(location_data)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  if(LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.Low4(location_data)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  #ifdef _LCD_BUSY_FLAG_ENABLE
+    if(LCD_I2C_Wait_Ready(lcd,1) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  #endif
+#endif
   
   //LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(location_data));
   //LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(location_data));
@@ -248,20 +494,33 @@ LCD_I2C_Status_Enum_t LCD_I2C_Location(uint8_t address, uint8_t row, uint8_t col
 /******************************************************************************
 * Function : LCD_I2C_Clear_Display()
 * Description: Clears the LCD display and resets the cursor to the home position.
+* With the framebuffer the frame is blanked too, so it matches the glass and
+* the next Flush has nothing to send. Initialize clears through here.
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display.
 * @return LCD_I2C_Status_Enum_t - Status of the operation.
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_Clear_Display(uint8_t address)
+LCD_I2C_Status_Enum_t LCD_I2C_Clear_Display(LCD_I2C_Device_t *lcd)
 {
-  if(LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(_LCD_CMD_CLEAR)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
-  if(LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_CLEAR)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  if(LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.High4(_LCD_CMD_CLEAR)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  if(LCD_I2C_Send(lcd,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_CLEAR)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
   
   //LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.High4(_LCD_CMD_CLEAR));
   //LCD_Status = LCD_I2C_Send(address,_LCD_RS_CMD,CORE.Low4(_LCD_CMD_CLEAR));  
   
-  // Delay for the LCD to process the clear command
-  __delay_ms(_LCD_CLEAR_DELAY_MS); 
+  // Wait for the LCD to process the clear command
+  if (LCD_I2C_Wait_Ready(lcd,_LCD_CLEAR_DELAY_MS) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+  // The glass is all spaces now - the frame follows
+  for (uint8_t row = 0; row < lcd->rows; row++){
+    for (uint8_t column = 0; column < lcd->columns; column++){
+      lcd->glass[row][column] = ' ';
+      lcd->frame[row][column] = ' ';
+      }
+    }
+  lcd->glass_valid = true;
+#endif
   
   // Return success if both commands succeeded
   return LCD_I2C_OK;
@@ -271,15 +530,22 @@ LCD_I2C_Status_Enum_t LCD_I2C_Clear_Display(uint8_t address)
 * Function : LCD_I2C_Write_Character()
 * Description: Writes a character to the LCD display.
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display.
 * @param character - The ASCII character to write to the display.
 * 
 * @return LCD_I2C_Status_Enum_t - Status of the operation.
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_Write_Character(uint8_t address, uint8_t character)
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Character(LCD_I2C_Device_t *lcd, uint8_t character)
 {
-  if(LCD_I2C_Send(address,_LCD_RS_DATA,CORE.High4(character)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
-  if(LCD_I2C_Send(address,_LCD_RS_DATA,CORE.Low4(character)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+#ifdef _LCD_STREAM_ENABLE
+  if(LCD_I2C_Stream(lcd,_LCD_RS_DATA,&character,1) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+#else
+  if(LCD_I2C_Send(lcd,_LCD_RS_DATA,CORE.High4(character)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  if(LCD_I2C_Send(lcd,_LCD_RS_DATA,CORE.Low4(character)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  #ifdef _LCD_BUSY_FLAG_ENABLE
+    if(LCD_I2C_Wait_Ready(lcd,1) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  #endif
+#endif
   
   //LCD_Status = LCD_I2C_Send(address,_LCD_RS_DATA,CORE.High4(character));
   //LCD_Status = LCD_I2C_Send(address,_LCD_RS_DATA,CORE.Low4(character));
@@ -291,18 +557,24 @@ LCD_I2C_Status_Enum_t LCD_I2C_Write_Character(uint8_t address, uint8_t character
 * Function : LCD_I2C_Write_String()
 * Description: Writes a string to the LCD display.
 *
-* @param address - The I2C address of the LCD.
+* @param lcd - The display.
 * @param StringData - The null-terminated string to display.
 * 
 * @return LCD_I2C_Status_Enum_t - Status of the last character written.
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_Write_String(uint8_t address, char *StringData)
+LCD_I2C_Status_Enum_t LCD_I2C_Write_String(LCD_I2C_Device_t *lcd, char *StringData)
 {
+#ifdef _LCD_STREAM_ENABLE
+  uint8_t length = 0;
+  
+  while (StringData[length] != '\0'){length++;}
+  return LCD_I2C_Stream(lcd,_LCD_RS_DATA,(const uint8_t *)StringData,length);
+#else
   LCD_I2C_Status_Enum_t LCD_Status = LCD_I2C_OK;
     
   // Loop through the string until the null terminator is reached
   for (uint8_t i = 0; StringData[i] != '\0'; i++) {
-    LCD_Status = LCD_I2C_Write_Character(address, StringData[i]);
+    LCD_Status = LCD_I2C_Write_Character(lcd, StringData[i]);
         
     // If any write operation fails, return immediately
     if (LCD_Status != LCD_I2C_OK) {
@@ -310,7 +582,836 @@ LCD_I2C_Status_Enum_t LCD_I2C_Write_String(uint8_t address, char *StringData)
         }
     }
 return LCD_Status;  // Return the last status (OK if all characters succeed)
+#endif
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Put()
+* Description: Adds a character or command to the stream, or sends it straight
+* away without stream mode. LCD_I2C_Put_End() finishes a run of Puts.
+*
+* @param lcd - The display.
+* @param RS - _LCD_RS_DATA for characters, _LCD_RS_CMD for commands.
+* @param data - Byte to send - commands must not be Clear or Home.
+*
+* @return LCD_I2C_Status_Enum_t - Status of the transmission.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Put(LCD_I2C_Device_t *lcd, bool RS, uint8_t data)
+{
+#ifdef _LCD_STREAM_ENABLE
+  return LCD_I2C_Stream_Put(lcd,RS,data);
+#else
+  if(LCD_I2C_Send(lcd,RS,CORE.High4(data)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  if(LCD_I2C_Send(lcd,RS,CORE.Low4(data)) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  #ifdef _LCD_BUSY_FLAG_ENABLE
+    if(LCD_I2C_Wait_Ready(lcd,1) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  #endif
+  return LCD_I2C_OK;
+#endif
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Put_End()
+* Description: Sends what LCD_I2C_Put() has streamed.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Put_End(LCD_I2C_Device_t *lcd)
+{
+#ifdef _LCD_STREAM_ENABLE
+  return LCD_I2C_Stream_End(lcd);
+#else
+  return LCD_I2C_OK;
+#endif
+}
+
+#ifdef _LCD_STREAM_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Stream()
+* Description: Sends bytes to the LCD as one I2C write (several if the data
+* does not fit _LCD_STREAM_BUFFER_SIZE).
+*
+* @param lcd - The display.
+* @param RS - _LCD_RS_DATA for characters, _LCD_RS_CMD for commands.
+* @param data - Bytes to send - commands must not be Clear or Home.
+* @param length - Number of bytes.
+*
+* @return LCD_I2C_Status_Enum_t - Status of the transmission.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Stream(LCD_I2C_Device_t *lcd, bool RS, const uint8_t *data, uint8_t length)
+{
+  for (uint8_t i = 0; i < length; i++) {
+    if (LCD_I2C_Stream_Put(lcd,RS,data[i]) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+    }
+  
+  return LCD_I2C_Stream_End(lcd);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Stream_Put()
+* Description: Adds one character or command to the stream buffer, sending the
+* buffer first if it would not fit. An RS change (and the start of each write)
+* gets a byte with EN low so RS is settled before the next EN rise. One display
+* at a time - end the stream before putting to another.
+*
+* @param lcd - The display.
+* @param RS - _LCD_RS_DATA for characters, _LCD_RS_CMD for commands.
+* @param data - Byte to send.
+*
+* @return LCD_I2C_Status_Enum_t - Status of any write the buffer needed.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Stream_Put(LCD_I2C_Device_t *lcd, bool RS, uint8_t data)
+{
+  if ((LCD_Stream_Count + 1 + _LCD_STREAM_BYTES_PER_CHAR) > _LCD_STREAM_BUFFER_SIZE) {
+    if (LCD_I2C_Stream_End(lcd) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+    }
+  
+  if ((LCD_Stream_Count == 0) || (lcd->data.bits.RS != RS)) {
+    lcd->data.bits.RS = RS;
+    lcd->data.bits.EN = LOW;
+    LCD_Stream_Buffer[LCD_Stream_Count++] = lcd->data.byte;
+    }
+  
+  LCD_Stream_Count = LCD_I2C_Stream_Pack(lcd, LCD_Stream_Buffer, LCD_Stream_Count, data);
+  return LCD_I2C_OK;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Stream_End()
+* Description: Sends whatever is in the stream buffer.
+*
+* @param lcd - The display.
+*
+* @return LCD_I2C_Status_Enum_t - Status of the transmission.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Stream_End(LCD_I2C_Device_t *lcd)
+{
+  uint8_t count = LCD_Stream_Count;
+  
+  LCD_Stream_Count = 0;
+  if (count == 0){return LCD_I2C_OK;}
+  
+  return LCD_I2C_Bus_Write(lcd,count,LCD_Stream_Buffer);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Stream_Pack()
+* Description: Adds one byte to the stream - EN high/low for each nibble, then
+* EN low padding to cover the execute time.
+*
+* @return uint8_t - New stream length.
+*******************************************************************************/
+uint8_t LCD_I2C_Stream_Pack(LCD_I2C_Device_t *lcd, uint8_t *stream, uint8_t count, uint8_t data)
+{
+  lcd->data.bits.LCD_DATA = CORE.High4(data);
+  lcd->data.bits.EN = HIGH;
+  stream[count++] = lcd->data.byte;
+  lcd->data.bits.EN = LOW;
+  stream[count++] = lcd->data.byte;   // High nibble latched on this falling edge
+  
+  lcd->data.bits.LCD_DATA = CORE.Low4(data);
+  lcd->data.bits.EN = HIGH;
+  stream[count++] = lcd->data.byte;
+  lcd->data.bits.EN = LOW;
+  stream[count++] = lcd->data.byte;   // Low nibble latched - execute time starts
+  
+  for (uint8_t pad = 0; pad < _LCD_STREAM_PAD_BYTES; pad++) {
+    stream[count++] = lcd->data.byte;
+    }
+  
+  return count;
+}
+#endif
+
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Frame_Clear()
+* Description: Fills the framebuffer with spaces - nothing is sent until Flush.
+*
+*******************************************************************************/
+void LCD_I2C_Frame_Clear(LCD_I2C_Device_t *lcd)
+{
+  for (uint8_t row = 0; row < lcd->rows; row++){
+    for (uint8_t column = 0; column < lcd->columns; column++){lcd->frame[row][column] = ' ';}
+    }
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Frame_Write()
+* Description: Copies a string into the framebuffer at row, column. Text past
+* the end of the row is dropped.
+*
+* @param lcd - The display.
+* @param row - The row number (0-based index).
+* @param column - The column number (0-based index).
+* @param StringData - The null-terminated string.
+*
+* Example:
+*   LCD.Frame_Write(&Panel_Left, 1, 0, "Temp");
+*   LCD.Flush(&Panel_Left);
+*******************************************************************************/
+void LCD_I2C_Frame_Write(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const char *StringData)
+{
+  if (row >= lcd->rows){return;}
+  
+  for (uint8_t i = 0; (StringData[i] != '\0') && (column < lcd->columns); i++, column++) {
+    lcd->frame[row][column] = (uint8_t)StringData[i];
+    }
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Frame_Character()
+* Description: Puts one character into the framebuffer.
+*
+*******************************************************************************/
+void LCD_I2C_Frame_Character(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t character)
+{
+  if ((row < lcd->rows) && (column < lcd->columns)){lcd->frame[row][column] = character;}
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Frame_Invalidate()
+* Description: Forgets what is on the glass - the next Flush redraws every cell.
+*
+*******************************************************************************/
+void LCD_I2C_Frame_Invalidate(LCD_I2C_Device_t *lcd)
+{
+  lcd->glass_valid = false;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Flush()
+* Description: Sends the cells that differ from the glass. Each changed run gets
+* one cursor command, runs closer than _LCD_FRAME_MERGE_GAP are joined. An
+* unchanged display costs nothing on the bus.
+*
+* @param lcd - The display.
+*
+* @return LCD_I2C_Status_Enum_t - Status of the transmission.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Flush(LCD_I2C_Device_t *lcd)
+{
+  for (uint8_t row = 0; row < lcd->rows; row++) {
+    if (LCD_I2C_Flush_Row(lcd, row) != LCD_I2C_OK) {
+      LCD_Stream_Count = 0;
+      lcd->glass_valid = false;  // Part of it may not have arrived
+      return LCD_I2C_GENERIC_ERROR;
+      }
+    }
+  
+  if (LCD_I2C_Stream_End(lcd) != LCD_I2C_OK) {
+    lcd->glass_valid = false;
+    return LCD_I2C_GENERIC_ERROR;
+    }
+  
+  lcd->glass_valid = true;
+  return LCD_I2C_OK;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Flush_Row()
+* Description: Adds the changed runs of one row to the stream.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Flush_Row(LCD_I2C_Device_t *lcd, uint8_t row)
+{
+  uint8_t column = 0;
+  uint8_t last;
+  
+  while (column < lcd->columns) {
+    if (!LCD_I2C_Frame_Dirty(lcd, row, column)) {
+      column++;
+      continue;
+      }
+    
+    // Run ends at the last dirty cell with no more than _LCD_FRAME_MERGE_GAP clean cells before it
+    last = column;
+    for (uint8_t scan = column + 1; (scan < lcd->columns) && ((scan - last) <= (_LCD_FRAME_MERGE_GAP + 1)); scan++) {
+      if (LCD_I2C_Frame_Dirty(lcd, row, scan)){last = scan;}
+      }
+    
+    if (LCD_I2C_Stream_Put(lcd,_LCD_RS_CMD,(uint8_t)(0x80 | (lcd->line_offset[row] + column))) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+    
+    for (; column <= last; column++) {
+      if (LCD_I2C_Stream_Put(lcd,_LCD_RS_DATA,lcd->frame[row][column]) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+      lcd->glass[row][column] = lcd->frame[row][column];
+      }
+    }
+  
+  return LCD_I2C_OK;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Frame_Dirty()
+* Description: true if the cell needs sending.
+*
+*******************************************************************************/
+bool LCD_I2C_Frame_Dirty(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column)
+{
+  return (!lcd->glass_valid || (lcd->frame[row][column] != lcd->glass[row][column]));
+}
+#endif
+
+#ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Refresh_Start()
+* Description: Starts feeding a display's framebuffer to it from the event
+* system. The display must already be initialized. Up to
+* _LCD_REFRESH_MAX_DISPLAYS displays take turns, one slice each.
+*
+* @param lcd - The display.
+*
+* @return LCD_I2C_Status_Enum_t - LCD_I2C_GENERIC_ERROR if every slot is in use.
+*
+* Example:
+*   LCD.Initialize(&Panel_Left);
+*   LCD.Frame_Clear(&Panel_Left);
+*   LCD.Refresh_Start(&Panel_Left);
+*   ...
+*   LCD.Frame_Write(&Panel_Left, 0, 0, "Running");   //Appears within a few ms
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Refresh_Start(LCD_I2C_Device_t *lcd)
+{
+  uint8_t free_slot = _LCD_REFRESH_MAX_DISPLAYS;
+  bool running = false;  // Another display already has the event
+  
+  for (uint8_t slot = 0; slot < _LCD_REFRESH_MAX_DISPLAYS; slot++) {
+    if (LCD_Refresh_List[slot] == lcd){return LCD_I2C_OK;}
+    if (LCD_Refresh_List[slot] != NULL){running = true;}
+    else if (free_slot == _LCD_REFRESH_MAX_DISPLAYS){free_slot = slot;}
+    }
+  if (free_slot == _LCD_REFRESH_MAX_DISPLAYS){return LCD_I2C_GENERIC_ERROR;}
+  
+  lcd->refresh_row = 0;
+  lcd->refresh_column = 0;
+  lcd->refresh_force = 0;
+  LCD_Refresh_List[free_slot] = lcd;
+  if (running){return LCD_I2C_OK;}
+  
+  LCD_Stream_Count = 0;
+#ifdef _LCD_I2C_ASYNC
+  LCD_Refresh_Transaction.status = I2C_OK;
+#endif
+  
+  CORE.Events_Add(_LCD_REFRESH_INTERVAL_MS, &LCD_I2C_Refresh_Slice, _LCD_REFRESH_INTERVAL_MS);
+  return LCD_I2C_OK;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Refresh_Stop()
+* Description: Stops the background refresh of a display. A slice already on
+* the bus (async) still completes.
+*
+*******************************************************************************/
+void LCD_I2C_Refresh_Stop(LCD_I2C_Device_t *lcd)
+{
+  bool running = false;
+  
+  for (uint8_t slot = 0; slot < _LCD_REFRESH_MAX_DISPLAYS; slot++) {
+    if (LCD_Refresh_List[slot] == lcd){LCD_Refresh_List[slot] = NULL;}
+    if (LCD_Refresh_List[slot] != NULL){running = true;}
+    }
+  
+  if (!running){CORE.Events_Remove(&LCD_I2C_Refresh_Slice);}
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Refresh_IsIdle()
+* Description: true when the display's glass matches its framebuffer and none
+* of it is on the bus.
+*
+*******************************************************************************/
+bool LCD_I2C_Refresh_IsIdle(LCD_I2C_Device_t *lcd)
+{
+#ifdef _LCD_I2C_ASYNC
+  if ((LCD_Refresh_Transaction.status == I2C_Busy) && (LCD_Refresh_Sending == lcd)){return false;}
+#endif
+  if (!lcd->glass_valid || (lcd->refresh_force > 0)){return false;}
+  
+  for (uint8_t row = 0; row < lcd->rows; row++){
+    for (uint8_t column = 0; column < lcd->columns; column++){
+      if (lcd->frame[row][column] != lcd->glass[row][column]){return false;}
+      }
+    }
+  return true;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Refresh_Slice()
+* Description: Event callback - sends the next stream buffer of changed cells
+* for the first display, taking turns, that has any. Nothing changed costs one
+* scan of each framebuffer and no bus traffic.
+*
+*******************************************************************************/
+void LCD_I2C_Refresh_Slice(void)
+{
+  LCD_I2C_Device_t *lcd;
+  
+#ifdef _LCD_I2C_ASYNC
+  if (LCD_Refresh_Transaction.status == I2C_Busy){return;}  // Previous slice still on the bus
+#endif
+  
+  for (uint8_t tries = 0; tries < _LCD_REFRESH_MAX_DISPLAYS; tries++) {
+    lcd = LCD_Refresh_List[LCD_Refresh_Next];
+    if (++LCD_Refresh_Next >= _LCD_REFRESH_MAX_DISPLAYS){LCD_Refresh_Next = 0;}
+    if (lcd == NULL){continue;}
+    
+    LCD_I2C_Refresh_Fill(lcd);
+    if (LCD_Stream_Count > 0) {
+      LCD_I2C_Refresh_Send(lcd);
+      return;
+      }
+    }
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Refresh_Send()
+* Description: Sends the slice in the stream buffer - submitted to the async
+* engine from a copy, or written straight away.
+*
+*******************************************************************************/
+void LCD_I2C_Refresh_Send(LCD_I2C_Device_t *lcd)
+{
+#ifdef _LCD_I2C_ASYNC
+  for (uint8_t i = 0; i < LCD_Stream_Count; i++){LCD_Refresh_Buffer[i] = LCD_Stream_Buffer[i];}
+  
+  LCD_Refresh_Sending = lcd;
+  LCD_Refresh_Transaction.address = lcd->address;
+  LCD_Refresh_Transaction.write_data = LCD_Refresh_Buffer;
+  LCD_Refresh_Transaction.write_length = LCD_Stream_Count;
+  LCD_Refresh_Transaction.read_length = 0;
+  LCD_Refresh_Transaction.callback = &LCD_I2C_Refresh_Done;
+  LCD_Refresh_Transaction.timeout_us = 0;
+  LCD_Stream_Count = 0;
+#ifdef _LCD_I2C_PRESENCE
+  if (I2C1_PRESENCE.IsMissing(lcd->address)){lcd->glass_valid = false; return;}  // Cache only - no blocking probe next to the async queue
+#endif
+  if (I2C1_ASYNC.Submit(&LCD_Refresh_Transaction) != I2C_OK){lcd->glass_valid = false;}  // Queue full - send it all again
+#else
+  if (LCD_I2C_Stream_End(lcd) != LCD_I2C_OK){lcd->glass_valid = false;}
+#endif
+}
+
+#ifdef _LCD_I2C_ASYNC
+/******************************************************************************
+* Function : LCD_I2C_Refresh_Done()
+* Description: Slice completion - runs from I2C1_ASYNC.Service(). Chains the
+* next slice straight away so a full redraw is not paced by the event interval.
+*
+*******************************************************************************/
+void LCD_I2C_Refresh_Done(I2C1_Transaction_t *transaction)
+{
+  if (transaction->status != I2C_OK) {
+    LCD_Refresh_Sending->glass_valid = false;
+#ifdef _LCD_I2C_PRESENCE
+    I2C1_PRESENCE.Invalidate(transaction->address);
+#endif
+    }
+  LCD_I2C_Refresh_Slice();
+}
+#endif
+
+/******************************************************************************
+* Function : LCD_I2C_Refresh_Fill()
+* Description: Scans on from where the display's last slice stopped and packs
+* changed cells into the stream buffer until it is full or every cell has been
+* checked. The glass is updated as cells are packed - a failed write
+* invalidates it.
+*
+*******************************************************************************/
+void LCD_I2C_Refresh_Fill(LCD_I2C_Device_t *lcd)
+{
+  uint16_t cells = (uint16_t)lcd->rows * lcd->columns;
+  bool positioned = false;  // Cursor is on this cell - no command needed
+  uint8_t row, column;
+  
+  if (!lcd->glass_valid) {
+    lcd->glass_valid = true;
+    lcd->refresh_force = (uint8_t)(lcd->rows * lcd->columns);
+    lcd->refresh_row = 0;
+    lcd->refresh_column = 0;
+    }
+  
+  while (cells-- > 0) {
+    row = lcd->refresh_row;
+    column = lcd->refresh_column;
+    
+    if ((lcd->refresh_force > 0) || (lcd->frame[row][column] != lcd->glass[row][column])) {
+      // A cursor command and its character or just the character - stop if they will not fit
+      if ((LCD_Stream_Count + ((positioned ? 1 : 2) * (1 + _LCD_STREAM_BYTES_PER_CHAR))) > _LCD_STREAM_BUFFER_SIZE){return;}
+      
+      if (!positioned) {
+        LCD_I2C_Stream_Put(lcd,_LCD_RS_CMD,(uint8_t)(0x80 | (lcd->line_offset[row] + column)));
+        positioned = true;
+        }
+      LCD_I2C_Stream_Put(lcd,_LCD_RS_DATA,lcd->frame[row][column]);
+      lcd->glass[row][column] = lcd->frame[row][column];
+      if (lcd->refresh_force > 0){lcd->refresh_force--;}
+      }
+    else {
+      positioned = false;
+      }
+    
+    if (++lcd->refresh_column >= lcd->columns) {
+      lcd->refresh_column = 0;
+      positioned = false;
+      if (++lcd->refresh_row >= lcd->rows){lcd->refresh_row = 0;}
+      }
+    }
+}
+#endif
+
+#ifdef _LCD_GLYPH_CACHE_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Glyph()
+* Description: Returns the character code for a custom glyph, uploading it to
+* CGRAM if it is not resident. The cursor is left in CGRAM after an upload.
+*
+* @param lcd - The display.
+* @param pattern - 8 rows, bits 4-0 - the pointer identifies the glyph.
+* @param character - Set to the code to write, 8-15.
+*
+* @return LCD_I2C_Status_Enum_t - LCD_I2C_NO_GLYPH_SLOT if every slot is on screen.
+*
+* Example:
+*   const uint8_t Bar_3[8] = {0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C};
+*   uint8_t bar;
+*   LCD.Glyph(&Panel_Left, Bar_3, &bar);
+*   LCD.Location(&Panel_Left, 1, 0);
+*   LCD.Write_Character(&Panel_Left, bar);
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Glyph(LCD_I2C_Device_t *lcd, const uint8_t *pattern, uint8_t *character)
+{
+  LCD_I2C_Status_Enum_t LCD_Status;
+  bool uploaded;
+  
+  LCD_Status = LCD_I2C_Glyph_Load(lcd, pattern, character, &uploaded);
+  if (LCD_Status != LCD_I2C_OK){return LCD_Status;}
+  
+  return LCD_I2C_Glyph_End(lcd, pattern, *character, uploaded);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Write_Glyph()
+* Description: Writes a custom glyph at row, column - the upload (if needed),
+* the cursor command and the character go out as one stream.
+*
+* @return LCD_I2C_Status_Enum_t - LCD_I2C_GENERIC_ERROR if row, column is off
+* the display - nothing is uploaded or sent.
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Glyph(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *pattern)
+{
+  uint8_t character;
+  LCD_I2C_Status_Enum_t LCD_Status;
+  bool uploaded;
+  
+  if ((row >= lcd->rows) || (column >= lcd->columns)){return LCD_I2C_GENERIC_ERROR;}
+  
+  // A failed Put has already emptied the stream - and left an uploaded slot empty
+  LCD_Status = LCD_I2C_Glyph_Load(lcd, pattern, &character, &uploaded);
+  if (LCD_Status != LCD_I2C_OK){return LCD_Status;}
+  if (LCD_I2C_Put(lcd,_LCD_RS_CMD,(uint8_t)(_LCD_CMD_SET_DDRAM | (lcd->line_offset[row] + column))) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  if (LCD_I2C_Put(lcd,_LCD_RS_DATA,character) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  
+  return LCD_I2C_Glyph_End(lcd, pattern, character, uploaded);
+}
+
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Frame_Glyph()
+* Description: Puts a custom glyph into the framebuffer. The upload, if one is
+* needed, is sent now - the cell goes out with the next Flush.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Glyph(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *pattern)
+{
+  uint8_t character;
+  LCD_I2C_Status_Enum_t LCD_Status;
+  
+  if ((row >= lcd->rows) || (column >= lcd->columns)){return LCD_I2C_GENERIC_ERROR;}
+  
+  LCD_Status = LCD_I2C_Glyph(lcd, pattern, &character);
+  if (LCD_Status != LCD_I2C_OK){return LCD_Status;}
+  
+  lcd->frame[row][column] = character;
+  return LCD_I2C_OK;
+}
+#endif
+
+/******************************************************************************
+* Function : LCD_I2C_Glyph_Load()
+* Description: Finds the pattern's slot or uploads it to the least recently
+* used one. The upload is put on the stream, not ended - the slot stays empty
+* until LCD_I2C_Glyph_End() has seen the stream go out.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Glyph_Load(LCD_I2C_Device_t *lcd, const uint8_t *pattern, uint8_t *character, bool *uploaded)
+{
+  uint8_t slot;
+  
+  *uploaded = false;
+  for (slot = 0; slot < _LCD_CGRAM_SLOTS; slot++) {
+    if (lcd->glyph[slot] == pattern){break;}
+    }
+  
+  if (slot == _LCD_CGRAM_SLOTS) {
+    slot = LCD_I2C_Glyph_Victim(lcd);
+    if (slot == _LCD_CGRAM_SLOTS){return LCD_I2C_NO_GLYPH_SLOT;}
+    
+    lcd->glyph[slot] = NULL;  // Unknown until the upload has gone out
+    if (LCD_I2C_Put(lcd,_LCD_RS_CMD,(uint8_t)(_LCD_CMD_SET_CGRAM | (slot << 3))) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+    for (uint8_t line = 0; line < _LCD_GLYPH_ROWS; line++) {
+      if (LCD_I2C_Put(lcd,_LCD_RS_DATA,pattern[line]) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+      }
+    *uploaded = true;
+    }
+  
+  LCD_I2C_Glyph_Touch(lcd, slot);
+  *character = _LCD_GLYPH_CODE_BASE + slot;
+  return LCD_I2C_OK;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Glyph_End()
+* Description: Ends the stream an upload went out on. The slot only records
+* the pattern once the write succeeded - after a failure it stays empty, so
+* the next use uploads again instead of showing whatever CGRAM holds.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Glyph_End(LCD_I2C_Device_t *lcd, const uint8_t *pattern, uint8_t character, bool uploaded)
+{
+  LCD_I2C_Status_Enum_t LCD_Status = LCD_I2C_Put_End(lcd);
+  
+  if (uploaded && (LCD_Status == LCD_I2C_OK)){lcd->glyph[character - _LCD_GLYPH_CODE_BASE] = pattern;}
+  return LCD_Status;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Glyph_Victim()
+* Description: The slot to upload into - an empty one, else the least recently
+* used one not in the framebuffer.
+*
+* @return uint8_t - Slot, _LCD_CGRAM_SLOTS if none can be reused.
+*******************************************************************************/
+uint8_t LCD_I2C_Glyph_Victim(LCD_I2C_Device_t *lcd)
+{
+  uint8_t victim = _LCD_CGRAM_SLOTS;
+  
+  for (uint8_t slot = 0; slot < _LCD_CGRAM_SLOTS; slot++) {
+    if (lcd->glyph[slot] == NULL){return slot;}
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+    if (LCD_I2C_Glyph_On_Frame(lcd, slot)){continue;}
+#endif
+    if ((victim == _LCD_CGRAM_SLOTS) || (lcd->glyph_age[slot] > lcd->glyph_age[victim])){victim = slot;}
+    }
+  
+  return victim;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Glyph_Touch()
+* Description: Makes slot the most recently used. The ages stay 0-7, one each,
+* so they never wrap.
+*
+*******************************************************************************/
+void LCD_I2C_Glyph_Touch(LCD_I2C_Device_t *lcd, uint8_t slot)
+{
+  uint8_t age = lcd->glyph_age[slot];
+  
+  for (uint8_t other = 0; other < _LCD_CGRAM_SLOTS; other++) {
+    if (lcd->glyph_age[other] < age){lcd->glyph_age[other]++;}
+    }
+  lcd->glyph_age[slot] = 0;
+}
+
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Glyph_On_Frame()
+* Description: true if any framebuffer cell uses the slot - only scanned when
+* a slot has to be reused.
+*
+*******************************************************************************/
+bool LCD_I2C_Glyph_On_Frame(LCD_I2C_Device_t *lcd, uint8_t slot)
+{
+  for (uint8_t row = 0; row < lcd->rows; row++){
+    for (uint8_t column = 0; column < lcd->columns; column++){
+      if ((lcd->frame[row][column] & 0xF7) == slot){return true;}  // Codes 0-7 and 8-15 are the same slots
+      }
+    }
+  return false;
+}
+#endif
+#endif
+
+#ifdef _LCD_FIELDS_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Write_Int()
+* Description: Writes a right aligned integer in a field of width characters.
+*
+* @param lcd - The display.
+* @param row - The row number (0-based index).
+* @param column - First column of the field.
+* @param width - Field width, up to _LCD_FIELD_MAX_WIDTH - must fit the row.
+* @param value - The number.
+*
+* @return LCD_I2C_Status_Enum_t - LCD_I2C_GENERIC_ERROR if the field does not fit.
+*
+* Example:
+*   LCD.Write_Int(&Panel_Left, 0, 16, 4, rpm);   //"  75" or "1500"
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Int(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value)
+{
+  return LCD_I2C_Write_Fixed(lcd, row, column, width, value, 0);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Write_Fixed()
+* Description: Writes a right aligned fixed point number - value is in units
+* of the last decimal place.
+*
+* Example:
+*   LCD.Write_Fixed(&Panel_Left, 1, 0, 6, millivolts, 3);   //" 3.300"
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Fixed(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value, uint8_t decimals)
+{
+  uint8_t field[_LCD_FIELD_MAX_WIDTH];
+  
+  if (!LCD_I2C_Field_Fits(lcd, row, column, width)){return LCD_I2C_GENERIC_ERROR;}
+  
+  LCD_I2C_Format_Fixed(field, width, value, decimals);
+  return LCD_I2C_Write_Field(lcd, row, column, field, width);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Write_Hex()
+* Description: Writes a hex number zero padded to the field width.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Hex(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, uint32_t value)
+{
+  uint8_t field[_LCD_FIELD_MAX_WIDTH];
+  
+  if (!LCD_I2C_Field_Fits(lcd, row, column, width)){return LCD_I2C_GENERIC_ERROR;}
+  
+  LCD_I2C_Format_Hex(field, width, value);
+  return LCD_I2C_Write_Field(lcd, row, column, field, width);
+}
+
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+/******************************************************************************
+* Function : LCD_I2C_Frame_Int()
+* Description: Formats a right aligned integer straight into the framebuffer.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Int(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value)
+{
+  return LCD_I2C_Frame_Fixed(lcd, row, column, width, value, 0);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Frame_Fixed()
+* Description: Formats a right aligned fixed point number straight into the
+* framebuffer.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Fixed(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value, uint8_t decimals)
+{
+  if (!LCD_I2C_Field_Fits(lcd, row, column, width)){return LCD_I2C_GENERIC_ERROR;}
+  
+  LCD_I2C_Format_Fixed(&lcd->frame[row][column], width, value, decimals);
+  return LCD_I2C_OK;
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Frame_Hex()
+* Description: Formats a zero padded hex number straight into the framebuffer.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Hex(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, uint32_t value)
+{
+  if (!LCD_I2C_Field_Fits(lcd, row, column, width)){return LCD_I2C_GENERIC_ERROR;}
+  
+  LCD_I2C_Format_Hex(&lcd->frame[row][column], width, value);
+  return LCD_I2C_OK;
+}
+#endif
+
+/******************************************************************************
+* Function : LCD_I2C_Field_Fits()
+* Description: true if the field is inside the display and not too wide.
+*
+*******************************************************************************/
+bool LCD_I2C_Field_Fits(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width)
+{
+  if ((width == 0) || (width > _LCD_FIELD_MAX_WIDTH) || (row >= lcd->rows)){return false;}
+  return ((column + width) <= lcd->columns);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Write_Field()
+* Description: Sends the cursor command and the field characters as one stream.
+*
+*******************************************************************************/
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Field(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *field, uint8_t width)
+{
+  if (LCD_I2C_Put(lcd,_LCD_RS_CMD,(uint8_t)(_LCD_CMD_SET_DDRAM | (lcd->line_offset[row] + column))) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+  
+  for (uint8_t i = 0; i < width; i++) {
+    if (LCD_I2C_Put(lcd,_LCD_RS_DATA,field[i]) != LCD_I2C_OK){return LCD_I2C_GENERIC_ERROR;}
+    }
+  
+  return LCD_I2C_Put_End(lcd);
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Format_Fixed()
+* Description: Fills width characters, right to left - digits with the point
+* after the decimals, zeros up to "0.", the sign, then spaces.
+*
+*******************************************************************************/
+void LCD_I2C_Format_Fixed(uint8_t *field, uint8_t width, int32_t value, uint8_t decimals)
+{
+  char digits[10];
+  uint8_t count;
+  uint8_t position = width;
+  bool negative = (value < 0);
+  
+  count = CORE.UintToDigits(negative ? ((uint32_t)0 - (uint32_t)value) : (uint32_t)value, digits);
+  
+  // Characters needed - at least one digit ahead of the point
+  if ((((count > decimals) ? count : (decimals + 1)) + ((decimals > 0) ? 1 : 0) + (negative ? 1 : 0)) > width) {
+    for (position = 0; position < width; position++){field[position] = _LCD_FIELD_OVERFLOW;}
+    return;
+    }
+  
+  for (uint8_t place = 0; (place < count) || (place <= decimals); place++) {
+    if ((place == decimals) && (decimals > 0)){field[--position] = '.';}
+    field[--position] = (place < count) ? (uint8_t)digits[count - 1 - place] : '0';
+    }
+  
+  if (negative){field[--position] = '-';}
+  while (position > 0){field[--position] = ' ';}
+}
+
+/******************************************************************************
+* Function : LCD_I2C_Format_Hex()
+* Description: Fills width characters with the value in hex, zero padded.
+*
+*******************************************************************************/
+void LCD_I2C_Format_Hex(uint8_t *field, uint8_t width, uint32_t value)
+{
+  static const char hex_digits[] = "0123456789ABCDEF";
+  uint8_t position = width;
+  
+  while (position > 0) {
+    field[--position] = (uint8_t)hex_digits[value & 0x0F];
+    value >>= 4;
+    }
+  
+  if (value != 0) {
+    for (position = 0; position < width; position++){field[position] = _LCD_FIELD_OVERFLOW;}
+    }
 }
+#endif
 
 
 
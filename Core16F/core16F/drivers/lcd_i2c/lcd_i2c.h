@@ -3,7 +3,7 @@
 * Filename              :   lcd_i2c.h
 * Author                :   Jamie Starling
 * Origin Date           :   2024/10/15
-* Version               :   1.0.0
+* Version               :   1.7.0
 * Compiler              :   XC8
 * Target                :   
 * Copyright             :   Jamie Starling
@@ -34,11 +34,22 @@
 *
 *    Date    Version   Author         Description 
 *    2024/10/16  1.0.0       Jamie Starling  Initial Version
+*    2026/10/18  1.1.0       Jamie Starling  Stream mode - whole strings in one I2C write
+*    2026/10/18  1.2.0       Jamie Starling  Shadow framebuffer - Flush only sends the cells that changed
+*    2026/10/18  1.3.0       Jamie Starling  Background refresh from the event system
+*    2026/10/18  1.4.0       Jamie Starling  Busy flag polling replaces the fixed command delays
+*    2026/10/18  1.5.0       Jamie Starling  LCD_I2C_Device_t - several displays, each with its own state and geometry
+*    2026/10/18  1.6.0       Jamie Starling  Glyph cache - any number of custom characters through the 8 CGRAM slots
+*    2026/10/18  1.7.0       Jamie Starling  Numeric fields - integer, fixed point and hex without sprintf
 *  
 *****************************************************************************/
 
 #ifndef _CORE_LCD_I2C_H
 #define _CORE_LCD_I2C_H
+
+#ifdef _LCD_PARALLEL_AS_LCD
+    #error "_LCD_PARALLEL_AS_LCD binds LCD to lcd_parallel - include lcd_parallel.h instead of lcd_i2c.h"
+#endif
 /******************************************************************************
 * Includes
 *******************************************************************************/
@@ -64,16 +75,151 @@
 #define _LCD_CMD_Function_Set 0b00101000
 #define _LCD_CMD_Display_Set 0b00001110
 #define _LCD_CMD_CLEAR 0b00000001
+#define _LCD_CMD_SET_CGRAM 0b01000000
+#define _LCD_CMD_SET_DDRAM 0b10000000
 
-#define _LCD_LINE_1 0x00
-#define _LCD_LINE_2 0x40
-#define _LCD_LINE_3 0x14
-#define _LCD_LINE_4 0x54
+#define _LCD_MAX_ROWS 4
 
 #define _LCD_INIT_DELAY_MS 10
 #define _LCD_CLEAR_DELAY_MS 5
 #define _LCD_DATA_DELAY_US 500
 
+/******************************************************************************
+* Busy Flag
+*
+* Reads the HD44780 busy flag back through the PCF8574 (RW on P1) and carries
+* on as soon as the controller is ready instead of waiting the fixed delays -
+* Clear is done in about 1.5ms rather than 5ms and most commands in 40us.
+* Backpacks with RW tied low read busy for ever - after _LCD_BUSY_POLL_LIMIT
+* polls the driver falls back to the fixed delays for good.
+*******************************************************************************/
+//#define _LCD_BUSY_FLAG_ENABLE
+#define _LCD_BUSY_POLL_LIMIT 100
+
+/******************************************************************************
+* Stream Mode
+*
+* Text and cursor commands are packed into one I2C write - every nibble is an
+* EN high byte then an EN low byte, and the PCF8574 outputs only change once
+* per I2C byte (9 bit times). That alone covers the HD44780 setup, hold and
+* EN pulse times (all under 1us). The only wait left is the execute time after
+* each character, padded with repeats of the EN low byte when the bus is fast
+* enough to beat it. Tools/lcd_stream_timing.py checks the stream against the
+* HD44780 timing for each bus speed.
+*
+* Comment out _LCD_STREAM_ENABLE for the original three transfers per nibble.
+*******************************************************************************/
+#define _LCD_STREAM_ENABLE
+#define _LCD_EXECUTE_TIME_US 53          //Slowest data/command time (190kHz oscillator) - Clear and Home not streamed
+#define _LCD_I2C_BYTE_TIME_US (9000000UL / _I2C1_BUS_SPEED_HZ)
+#define _LCD_STREAM_PAD_BYTES (((_LCD_EXECUTE_TIME_US + _LCD_I2C_BYTE_TIME_US - 1) / _LCD_I2C_BYTE_TIME_US) - 1)
+#define _LCD_STREAM_BYTES_PER_CHAR (4 + _LCD_STREAM_PAD_BYTES)
+#define _LCD_STREAM_BUFFER_SIZE 40       //Longer strings go out as several writes
+
+/******************************************************************************
+* Framebuffer
+*
+* The application draws into a RAM copy of the display (LCD.Frame_Write...)
+* and LCD.Flush() sends only the cells that differ from what is on the glass,
+* as one stream with a cursor command in front of each changed run. Short
+* unchanged gaps are rewritten rather than skipped - a cursor command costs
+* more than _LCD_FRAME_MERGE_GAP characters. Needs _LCD_STREAM_ENABLE.
+*
+* Two bytes of RAM per cell in every LCD_I2C_Device_t - 160 bytes for a 20x4.
+* _LCD_ROWS and _LCD_COLUMNS size it for the largest display used. Writing to
+* the display directly (LCD.Write, LCD.Location) leaves the copy stale - call
+* LCD.Frame_Invalidate() afterwards and the next Flush redraws everything.
+*******************************************************************************/
+//#define _LCD_FRAMEBUFFER_ENABLE
+#define _LCD_ROWS 4
+#define _LCD_COLUMNS 20
+#define _LCD_FRAME_MERGE_GAP 1
+
+#if defined(_LCD_FRAMEBUFFER_ENABLE) && !defined(_LCD_STREAM_ENABLE)
+    #error "The LCD framebuffer flushes through stream mode - define _LCD_STREAM_ENABLE"
+#endif
+
+/******************************************************************************
+* Background Refresh
+*
+* LCD.Refresh_Start() registers a slice with the event system. Every
+* _LCD_REFRESH_INTERVAL_MS the slice sends the next changed cells of the
+* framebuffer - at most one stream buffer, one I2C write - and returns, so
+* the main loop never waits on the display. Drawing is just Frame_* calls.
+*
+* With the I2C1 async engine enabled the slice is submitted as a transaction
+* and the next slice is chained from its completion, the bus is never waited
+* on at all. I2C1_ASYNC.Initialize() must have been called.
+*
+* Up to _LCD_REFRESH_MAX_DISPLAYS displays can be refreshed, they take turns
+* a slice at a time. While the refresh runs only the Frame_* calls may be used
+* on that display.
+*******************************************************************************/
+//#define _LCD_BACKGROUND_REFRESH_ENABLE
+#define _LCD_REFRESH_INTERVAL_MS 2
+#define _LCD_REFRESH_MAX_DISPLAYS 3
+
+#if defined(_CORE16F_SYSTEM_EVENTS_ENABLE) || defined(_CORE18F_SYSTEM_EVENTS_ENABLE)
+    #define _LCD_EVENTS_AVAILABLE
+#endif
+
+#if defined(_CORE16F_HAL_I2C1_ASYNC_ENABLE) || defined(_CORE18F_HAL_I2C1_ASYNC_ENABLE)
+    #define _LCD_I2C_ASYNC
+#endif
+
+#if defined(_CORE16F_HAL_I2C1_PRESENCE_ENABLE) || defined(_CORE18F_HAL_I2C1_PRESENCE_ENABLE)
+    #define _LCD_I2C_PRESENCE   // Writes skip a display the presence cache knows is missing
+#endif
+
+#ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+    #ifndef _LCD_FRAMEBUFFER_ENABLE
+        #error "LCD background refresh draws from the framebuffer - define _LCD_FRAMEBUFFER_ENABLE"
+    #endif
+    #ifndef _LCD_EVENTS_AVAILABLE
+        #error "LCD background refresh runs from the event system - enable the system events"
+    #endif
+#endif
+
+/******************************************************************************
+* Glyph Cache
+*
+* Custom characters are 8 byte patterns (5 bits per row, top row first) in the
+* application's const data, any number of them. LCD.Glyph() returns the
+* character code to write for a pattern, uploading it to one of the 8 CGRAM
+* slots only if it is not already there - the least recently used slot is
+* reused. A screen change that reuses the same glyphs costs nothing.
+*
+* The codes are 8-15 (CGRAM mirrors 0-7 there) so they can go in strings.
+* Re-uploading a slot changes every cell on the glass that shows it - with the
+* framebuffer enabled slots still in the framebuffer are never reused, and a
+* ninth glyph on screen returns LCD_I2C_NO_GLYPH_SLOT. An upload leaves the
+* cursor in CGRAM, call LCD.Location() before writing text.
+*
+* Uploads are blocking writes - with the async refresh running, load the
+* glyphs before LCD.Refresh_Start().
+*******************************************************************************/
+//#define _LCD_GLYPH_CACHE_ENABLE
+#define _LCD_CGRAM_SLOTS 8
+#define _LCD_GLYPH_ROWS 8
+#define _LCD_GLYPH_CODE_BASE 8
+
+/******************************************************************************
+* Numeric Fields
+*
+* LCD.Write_Int(), Write_Fixed() and Write_Hex() draw a number right aligned
+* in a field of width characters at row, column - the cursor command and the
+* field go out as one stream, with no sprintf and no string in between. The
+* Frame_ versions format straight into the framebuffer. Digits come from
+* CORE.UintToDigits(). A number too wide for its field fills the field with
+* _LCD_FIELD_OVERFLOW, so a stale reading is never half shown.
+*
+* Fixed point takes the value in its smallest unit - 2345 with 2 decimals
+* is 23.45. Hex is zero padded to the width.
+*******************************************************************************/
+//#define _LCD_FIELDS_ENABLE
+#define _LCD_FIELD_MAX_WIDTH 12          //Sign, 10 digits and the point
+#define _LCD_FIELD_OVERFLOW '*'
+
 /******************************************************************************
 * Typedefs
 *******************************************************************************/
@@ -81,7 +227,8 @@ typedef enum
 {
  LCD_I2C_OK,
  LCD_I2C_GENERIC_ERROR,
- LCD_I2C_INVALID_ADDRESS 
+ LCD_I2C_INVALID_ADDRESS,
+ LCD_I2C_NO_GLYPH_SLOT
 }LCD_I2C_Status_Enum_t;
 
 
@@ -99,18 +246,81 @@ typedef union {
     uint8_t byte;         // Access the entire byte
 } LCD_DATA_ByteAccess;
 
-extern LCD_DATA_ByteAccess LCD_Data;
+/*One per display, owned by the application. Fill in the address and geometry
+ *(the LCD_I2C_1602()... initializers below) - the rest is driver state, set
+ *up by LCD.Initialize().*/
+typedef struct
+{
+  uint8_t address;                              //7-bit I2C address of the backpack
+  uint8_t rows;
+  uint8_t columns;
+  uint8_t line_offset[_LCD_MAX_ROWS];           //DDRAM address of the first cell of each row
+  LCD_DATA_ByteAccess data;                     //PCF8574 outputs - backlight and control bits
+  #ifdef _LCD_BUSY_FLAG_ENABLE
+    bool busy_flag_usable;
+  #endif
+  #ifdef _LCD_FRAMEBUFFER_ENABLE
+    uint8_t frame[_LCD_ROWS][_LCD_COLUMNS];     //What the application wants shown
+    uint8_t glass[_LCD_ROWS][_LCD_COLUMNS];     //What the display is showing
+    bool glass_valid;                           //false - glass is unknown, Flush redraws everything
+  #endif
+  #ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+    uint8_t refresh_row;                        //Where the next slice carries on scanning
+    uint8_t refresh_column;
+    uint8_t refresh_force;                      //Cells still to send regardless of the glass - after an invalidate
+  #endif
+  #ifdef _LCD_GLYPH_CACHE_ENABLE
+    const uint8_t *glyph[_LCD_CGRAM_SLOTS];     //Pattern in each CGRAM slot, NULL for empty
+    uint8_t glyph_age[_LCD_CGRAM_SLOTS];        //0 for the most recently used slot ... 7 for the least
+  #endif
+}LCD_I2C_Device_t;
+
+/*Common HD44780 geometries*/
+#define LCD_I2C_0802(addr) {.address = (addr), .rows = 2, .columns = 8,  .line_offset = {0x00, 0x40, 0x00, 0x00}}
+#define LCD_I2C_1602(addr) {.address = (addr), .rows = 2, .columns = 16, .line_offset = {0x00, 0x40, 0x00, 0x00}}
+#define LCD_I2C_1604(addr) {.address = (addr), .rows = 4, .columns = 16, .line_offset = {0x00, 0x40, 0x10, 0x50}}
+#define LCD_I2C_2002(addr) {.address = (addr), .rows = 2, .columns = 20, .line_offset = {0x00, 0x40, 0x00, 0x00}}
+#define LCD_I2C_2004(addr) {.address = (addr), .rows = 4, .columns = 20, .line_offset = {0x00, 0x40, 0x14, 0x54}}
 
 /******************************************************************************
 ***** LCD_I2C Interface
 *******************************************************************************/
 typedef struct {
-  LCD_I2C_Status_Enum_t (*Initialize)(uint8_t address);
-  LCD_I2C_Status_Enum_t (*BlackLight)(uint8_t address, LogicEnum_t set_light);
-  LCD_I2C_Status_Enum_t (*Location)(uint8_t address, uint8_t row, uint8_t column);
-  LCD_I2C_Status_Enum_t (*Clear)(uint8_t address);
-  LCD_I2C_Status_Enum_t (*Write_Character)(uint8_t address, uint8_t character);
-  LCD_I2C_Status_Enum_t (*Write)(uint8_t address, char *StringData);
+  LCD_I2C_Status_Enum_t (*Initialize)(LCD_I2C_Device_t *lcd);
+  LCD_I2C_Status_Enum_t (*BlackLight)(LCD_I2C_Device_t *lcd, LogicEnum_t set_light);
+  LCD_I2C_Status_Enum_t (*Location)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column);
+  LCD_I2C_Status_Enum_t (*Clear)(LCD_I2C_Device_t *lcd);
+  LCD_I2C_Status_Enum_t (*Write_Character)(LCD_I2C_Device_t *lcd, uint8_t character);
+  LCD_I2C_Status_Enum_t (*Write)(LCD_I2C_Device_t *lcd, char *StringData);
+  #ifdef _LCD_FRAMEBUFFER_ENABLE
+    void (*Frame_Clear)(LCD_I2C_Device_t *lcd);
+    void (*Frame_Write)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const char *StringData);
+    void (*Frame_Character)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t character);
+    void (*Frame_Invalidate)(LCD_I2C_Device_t *lcd);
+    LCD_I2C_Status_Enum_t (*Flush)(LCD_I2C_Device_t *lcd);
+  #endif
+  #ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+    LCD_I2C_Status_Enum_t (*Refresh_Start)(LCD_I2C_Device_t *lcd);
+    void (*Refresh_Stop)(LCD_I2C_Device_t *lcd);
+    bool (*Refresh_IsIdle)(LCD_I2C_Device_t *lcd);
+  #endif
+  #ifdef _LCD_GLYPH_CACHE_ENABLE
+    LCD_I2C_Status_Enum_t (*Glyph)(LCD_I2C_Device_t *lcd, const uint8_t *pattern, uint8_t *character);
+    LCD_I2C_Status_Enum_t (*Write_Glyph)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *pattern);
+    #ifdef _LCD_FRAMEBUFFER_ENABLE
+      LCD_I2C_Status_Enum_t (*Frame_Glyph)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *pattern);
+    #endif
+  #endif
+  #ifdef _LCD_FIELDS_ENABLE
+    LCD_I2C_Status_Enum_t (*Write_Int)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value);
+    LCD_I2C_Status_Enum_t (*Write_Fixed)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value, uint8_t decimals);
+    LCD_I2C_Status_Enum_t (*Write_Hex)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, uint32_t value);
+    #ifdef _LCD_FRAMEBUFFER_ENABLE
+      LCD_I2C_Status_Enum_t (*Frame_Int)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value);
+      LCD_I2C_Status_Enum_t (*Frame_Fixed)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value, uint8_t decimals);
+      LCD_I2C_Status_Enum_t (*Frame_Hex)(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, uint32_t value);
+    #endif
+  #endif
 }LCD_I2C_Interface_t;
 
 extern const LCD_I2C_Interface_t LCD;
@@ -118,12 +328,49 @@ extern const LCD_I2C_Interface_t LCD;
 /******************************************************************************
 * Function Prototypes
 *******************************************************************************/
-LCD_I2C_Status_Enum_t LCD_I2C_init(uint8_t address);
-LCD_I2C_Status_Enum_t LCD_I2C_BackLight(uint8_t address, LogicEnum_t set_light);
-LCD_I2C_Status_Enum_t LCD_I2C_Location(uint8_t address, uint8_t row, uint8_t column);
-LCD_I2C_Status_Enum_t LCD_I2C_Clear_Display(uint8_t address);
-LCD_I2C_Status_Enum_t LCD_I2C_Write_Character(uint8_t address, uint8_t character);
-LCD_I2C_Status_Enum_t LCD_I2C_Write_String(uint8_t address, char *StringData);
+LCD_I2C_Status_Enum_t LCD_I2C_init(LCD_I2C_Device_t *lcd);
+LCD_I2C_Status_Enum_t LCD_I2C_BackLight(LCD_I2C_Device_t *lcd, LogicEnum_t set_light);
+LCD_I2C_Status_Enum_t LCD_I2C_Location(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column);
+LCD_I2C_Status_Enum_t LCD_I2C_Clear_Display(LCD_I2C_Device_t *lcd);
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Character(LCD_I2C_Device_t *lcd, uint8_t character);
+LCD_I2C_Status_Enum_t LCD_I2C_Write_String(LCD_I2C_Device_t *lcd, char *StringData);
+LCD_I2C_Status_Enum_t LCD_I2C_Put(LCD_I2C_Device_t *lcd, bool RS, uint8_t data);
+LCD_I2C_Status_Enum_t LCD_I2C_Put_End(LCD_I2C_Device_t *lcd);
+#ifdef _LCD_STREAM_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Stream(LCD_I2C_Device_t *lcd, bool RS, const uint8_t *data, uint8_t length);
+LCD_I2C_Status_Enum_t LCD_I2C_Stream_Put(LCD_I2C_Device_t *lcd, bool RS, uint8_t data);
+LCD_I2C_Status_Enum_t LCD_I2C_Stream_End(LCD_I2C_Device_t *lcd);
+#endif
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+void LCD_I2C_Frame_Clear(LCD_I2C_Device_t *lcd);
+void LCD_I2C_Frame_Write(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const char *StringData);
+void LCD_I2C_Frame_Character(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t character);
+void LCD_I2C_Frame_Invalidate(LCD_I2C_Device_t *lcd);
+LCD_I2C_Status_Enum_t LCD_I2C_Flush(LCD_I2C_Device_t *lcd);
+#endif
+#ifdef _LCD_BACKGROUND_REFRESH_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Refresh_Start(LCD_I2C_Device_t *lcd);
+void LCD_I2C_Refresh_Stop(LCD_I2C_Device_t *lcd);
+bool LCD_I2C_Refresh_IsIdle(LCD_I2C_Device_t *lcd);
+void LCD_I2C_Refresh_Slice(void);
+#endif
+#ifdef _LCD_GLYPH_CACHE_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Glyph(LCD_I2C_Device_t *lcd, const uint8_t *pattern, uint8_t *character);
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Glyph(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *pattern);
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Glyph(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, const uint8_t *pattern);
+#endif
+#endif
+#ifdef _LCD_FIELDS_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Int(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value);
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Fixed(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value, uint8_t decimals);
+LCD_I2C_Status_Enum_t LCD_I2C_Write_Hex(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, uint32_t value);
+#ifdef _LCD_FRAMEBUFFER_ENABLE
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Int(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value);
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Fixed(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, int32_t value, uint8_t decimals);
+LCD_I2C_Status_Enum_t LCD_I2C_Frame_Hex(LCD_I2C_Device_t *lcd, uint8_t row, uint8_t column, uint8_t width, uint32_t value);
+#endif
+#endif
 #endif /*_CORE_LCD_I2C_H*/
 
 /*** End of File **************************************************************/
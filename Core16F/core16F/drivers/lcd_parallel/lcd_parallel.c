@@ -0,0 +1,259 @@
+/****************************************************************************
+* Title                 :   LCD Parallel Drivers
+* Filename              :   lcd_parallel.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "lcd_parallel.h"
+
+/******************************************************************************
+* Interface
+*******************************************************************************/
+const LCD_Parallel_Interface_t LCD_PARALLEL = {
+  .Initialize = &LCD_PARALLEL_Init,
+  .BlackLight = &LCD_PARALLEL_BackLight,
+  .Location = &LCD_PARALLEL_Location,
+  .Clear = &LCD_PARALLEL_Clear_Display,
+  .Write_Character = &LCD_PARALLEL_Write_Character,
+  .Write = &LCD_PARALLEL_Write_String,
+};
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool LCD_PARALLEL_Output_Pin(GPIO_Ports_t PortPin);
+void LCD_PARALLEL_Pin(GPIO_Ports_t PortPin, LogicEnum_t PinLevel);
+void LCD_PARALLEL_Nibble(LCD_Parallel_Device_t *lcd, uint8_t nibble);
+void LCD_PARALLEL_Send(LCD_Parallel_Device_t *lcd, bool RS, uint8_t data);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Init()
+* Description: Checks the pins, makes them outputs and starts the LCD in 4-bit
+* mode.
+*
+* @param lcd - The display - pins and geometry filled in, see LCD_PARALLEL_2004().
+* @return LCD_Parallel_Status_Enum_t - LCD_PARALLEL_INVALID_PINS if D4-D7 are
+* not four pins in a row on one port, or any pin cannot drive (input only, or
+* not in GPIO_Register_LU), or RS and EN clash with each other or the data.
+*
+* Example:
+*   LCD_Parallel_Device_t Panel = LCD_PARALLEL_2004(PORTB_0, PORTB_4, PORTB_5, _LCD_PARALLEL_NO_PIN);
+*   LCD_PARALLEL.Initialize(&Panel);
+*   LCD_PARALLEL.Write(&Panel, "Hello");
+*******************************************************************************/
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Init(LCD_Parallel_Device_t *lcd)
+{
+  uint8_t mask;
+  
+  if ((lcd->rows == 0) || (lcd->rows > _LCD_PARALLEL_MAX_ROWS) || (lcd->columns == 0)){return LCD_PARALLEL_GENERIC_ERROR;}
+  if (!LCD_PARALLEL_Output_Pin(lcd->rs) || !LCD_PARALLEL_Output_Pin(lcd->en) || (lcd->rs == lcd->en)){return LCD_PARALLEL_INVALID_PINS;}
+  if ((lcd->backlight != _LCD_PARALLEL_NO_PIN) && !LCD_PARALLEL_Output_Pin(lcd->backlight)){return LCD_PARALLEL_INVALID_PINS;}
+  
+  // D4-D7 - one LAT register, bits in a row from D4's
+  for (uint8_t pin = 0; pin < 4; pin++) {
+    GPIO_Ports_t data = (GPIO_Ports_t)(lcd->d4 + pin);
+    
+    if (!LCD_PARALLEL_Output_Pin(data) || (data == lcd->rs) || (data == lcd->en)){return LCD_PARALLEL_INVALID_PINS;}
+    if (GPIO_Register_LU[data].write_reg != GPIO_Register_LU[lcd->d4].write_reg){return LCD_PARALLEL_INVALID_PINS;}
+    if (GPIO_Register_LU[data].pinmask != (uint8_t)(GPIO_Register_LU[lcd->d4].pinmask << pin)){return LCD_PARALLEL_INVALID_PINS;}
+    }
+  
+  // D4's bit position - the data nibble is shifted up to it
+  lcd->data_shift = 0;
+  for (mask = GPIO_Register_LU[lcd->d4].pinmask; mask > 1; mask >>= 1){lcd->data_shift++;}
+  
+  for (uint8_t pin = 0; pin < 4; pin++){GPIO.ModeSet((GPIO_Ports_t)(lcd->d4 + pin), OUTPUT);}
+  GPIO.ModeSet(lcd->rs, OUTPUT);
+  GPIO.ModeSet(lcd->en, OUTPUT);
+  LCD_PARALLEL_Pin(lcd->en, LOW);
+  if (lcd->backlight != _LCD_PARALLEL_NO_PIN){GPIO.ModeSet(lcd->backlight, OUTPUT);}
+  
+  __delay_ms(_LCD_PARALLEL_POWER_UP_DELAY_MS);
+  
+  // Sync from any state - 8-bit mode three times, then 4-bit mode
+  LCD_PARALLEL_Pin(lcd->rs, LOW);
+  LCD_PARALLEL_Nibble(lcd, _LCD_PARALLEL_CMD_8bit_Mode);
+  __delay_ms(_LCD_PARALLEL_SYNC_DELAY_MS);
+  LCD_PARALLEL_Nibble(lcd, _LCD_PARALLEL_CMD_8bit_Mode);
+  __delay_us(_LCD_PARALLEL_EXECUTE_DELAY_US * 2);
+  LCD_PARALLEL_Nibble(lcd, _LCD_PARALLEL_CMD_8bit_Mode);
+  __delay_us(_LCD_PARALLEL_EXECUTE_DELAY_US * 2);
+  LCD_PARALLEL_Nibble(lcd, _LCD_PARALLEL_CMD_4bit_Mode);
+  __delay_us(_LCD_PARALLEL_EXECUTE_DELAY_US * 2);
+  
+  LCD_PARALLEL_Send(lcd, _LCD_PARALLEL_RS_CMD, _LCD_PARALLEL_CMD_Function_Set);
+  LCD_PARALLEL_Send(lcd, _LCD_PARALLEL_RS_CMD, _LCD_PARALLEL_CMD_Display_Set);
+  LCD_PARALLEL_Send(lcd, _LCD_PARALLEL_RS_CMD, _LCD_PARALLEL_CMD_Entry_Mode);
+  
+  return LCD_PARALLEL_Clear_Display(lcd);
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_BackLight()
+* Description: Controls the backlight pin, if the display has one.
+*
+* @param lcd - The display.
+* @param set_light - The desired state of the backlight (ON or OFF).
+*
+* @return LCD_Parallel_Status_Enum_t - LCD_PARALLEL_GENERIC_ERROR without a backlight pin.
+*******************************************************************************/
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_BackLight(LCD_Parallel_Device_t *lcd, LogicEnum_t set_light)
+{
+  if (lcd->backlight == _LCD_PARALLEL_NO_PIN){return LCD_PARALLEL_GENERIC_ERROR;}
+  
+  LCD_PARALLEL_Pin(lcd->backlight, (set_light == ON) ? HIGH : LOW);
+  return LCD_PARALLEL_OK;
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Location()
+* Description: Sets the cursor position on the LCD display.
+*
+* @param lcd - The display.
+* @param row - The row number (0-based index).
+* @param column - The column number (0-based index).
+*
+* @return LCD_Parallel_Status_Enum_t - LCD_PARALLEL_GENERIC_ERROR for an invalid row.
+*******************************************************************************/
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Location(LCD_Parallel_Device_t *lcd, uint8_t row, uint8_t column)
+{
+  if (row >= lcd->rows){return LCD_PARALLEL_GENERIC_ERROR;}
+  
+  LCD_PARALLEL_Send(lcd, _LCD_PARALLEL_RS_CMD, (uint8_t)(_LCD_PARALLEL_CMD_SET_DDRAM | (lcd->line_offset[row] + column)));
+  return LCD_PARALLEL_OK;
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Clear_Display()
+* Description: Clears the LCD display and resets the cursor to the home position.
+*
+*******************************************************************************/
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Clear_Display(LCD_Parallel_Device_t *lcd)
+{
+  LCD_PARALLEL_Send(lcd, _LCD_PARALLEL_RS_CMD, _LCD_PARALLEL_CMD_CLEAR);
+  __delay_ms(_LCD_PARALLEL_CLEAR_DELAY_MS);
+  return LCD_PARALLEL_OK;
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Write_Character()
+* Description: Writes a character to the LCD display.
+*
+*******************************************************************************/
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Write_Character(LCD_Parallel_Device_t *lcd, uint8_t character)
+{
+  LCD_PARALLEL_Send(lcd, _LCD_PARALLEL_RS_DATA, character);
+  return LCD_PARALLEL_OK;
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Write_String()
+* Description: Writes a string to the LCD display.
+*
+* @param lcd - The display.
+* @param StringData - The null-terminated string to display.
+*******************************************************************************/
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Write_String(LCD_Parallel_Device_t *lcd, char *StringData)
+{
+  for (uint8_t i = 0; StringData[i] != '\0'; i++) {
+    LCD_PARALLEL_Send(lcd, _LCD_PARALLEL_RS_DATA, (uint8_t)StringData[i]);
+    }
+  return LCD_PARALLEL_OK;
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Output_Pin()
+* Description: True if the pin can drive - it has a LAT register in
+* GPIO_Register_LU and is not the input only pin.
+*
+*******************************************************************************/
+bool LCD_PARALLEL_Output_Pin(GPIO_Ports_t PortPin)
+{
+  return (PortPin < _LCD_PARALLEL_LU_PINS) && (PortPin != _LCD_PARALLEL_INPUT_ONLY_PIN);
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Send()
+* Description: Sends a command or character as two nibbles, then waits out the
+* execute time.
+*
+*******************************************************************************/
+void LCD_PARALLEL_Send(LCD_Parallel_Device_t *lcd, bool RS, uint8_t data)
+{
+  LCD_PARALLEL_Pin(lcd->rs, RS ? HIGH : LOW);
+  LCD_PARALLEL_Nibble(lcd, CORE.High4(data));
+  LCD_PARALLEL_Nibble(lcd, CORE.Low4(data));
+  __delay_us(_LCD_PARALLEL_EXECUTE_DELAY_US);
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Nibble()
+* Description: Puts a nibble on D4-D7 with one LAT write and pulses EN - the
+* controller latches it on the falling edge.
+*
+*******************************************************************************/
+void LCD_PARALLEL_Nibble(LCD_Parallel_Device_t *lcd, uint8_t nibble)
+{
+  volatile unsigned char *data_lat = GPIO_Register_LU[lcd->d4].write_reg;
+  uint8_t data_mask = (uint8_t)(0x0F << lcd->data_shift);
+  
+  *data_lat = (uint8_t)((*data_lat & ~data_mask) | ((nibble << lcd->data_shift) & data_mask));
+  
+  LCD_PARALLEL_Pin(lcd->en, HIGH);   // Data setup (195ns) is covered by the call
+  __delay_us(_LCD_PARALLEL_EN_PULSE_US);
+  LCD_PARALLEL_Pin(lcd->en, LOW);
+}
+
+/******************************************************************************
+* Function : LCD_PARALLEL_Pin()
+* Description: Sets one control pin straight through its LAT register.
+*
+*******************************************************************************/
+void LCD_PARALLEL_Pin(GPIO_Ports_t PortPin, LogicEnum_t PinLevel)
+{
+  if (PinLevel == HIGH){*(GPIO_Register_LU[PortPin].write_reg) |= GPIO_Register_LU[PortPin].pinmask;}
+  else {*(GPIO_Register_LU[PortPin].write_reg) &= ~(GPIO_Register_LU[PortPin].pinmask);}
+}
+
+/*** End of File **************************************************************/
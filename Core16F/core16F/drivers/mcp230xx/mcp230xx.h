@@ -0,0 +1,159 @@
+/****************************************************************************
+* Title                 :   MCP23017 / MCP23008 I2C GPIO Expander Driver
+* Filename              :   mcp230xx.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+#ifndef _COREMCU_MCP230XX_H
+#define _COREMCU_MCP230XX_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core_version.h"
+
+#ifdef _CORE16_MCU
+    #include "../../core16F.h"
+#endif
+
+#ifdef _CORE18_MCU
+	#include "../../core18F.h"
+#endif
+
+/******************************************************************************
+* MCP23017 (16 pins) and MCP23008 (8 pins) on I2C1.
+*
+* The calls mirror GPIO - ModeSet, PinWrite, PinToggle and PinRead - with the
+* expander as the first parameter. ModeSet, PinWrite and PinToggle only change
+* shadow copies of IODIR, GPPU and OLAT, nothing goes on the bus until
+* MCP230XX.Flush(). Flush writes just the registers that differ from what the
+* chip holds, ports A and B together in one write - so a batch of pin changes
+* costs at most three short writes instead of a read-modify-write per pin.
+*
+* PinRead and ReadPorts read the pins live from the GPIO registers.
+*
+* The chip's IOCON is left at its reset value - BANK = 0 with A and B
+* registers side by side, sequential addressing on.
+*******************************************************************************/
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+#define _MCP230XX_BASE_ADDRESS 0x20       //A2..A0 tied low
+
+#if defined(_CORE16F_HAL_I2C1_PRESENCE_ENABLE) || defined(_CORE18F_HAL_I2C1_PRESENCE_ENABLE)
+    #define _MCP230XX_PRESENCE   //Transfers skip a part the presence cache knows is missing
+#endif
+
+/*Register addresses, BANK = 0 - port B is the next address on an MCP23017*/
+#define _MCP23017_IODIR 0x00
+#define _MCP23017_GPPU 0x0C
+#define _MCP23017_GPIO 0x12
+#define _MCP23017_OLAT 0x14
+#define _MCP23008_IODIR 0x00
+#define _MCP23008_GPPU 0x06
+#define _MCP23008_GPIO 0x09
+#define _MCP23008_OLAT 0x0A
+
+/*Shadowed registers, in the order Flush writes them - pull-ups and levels are
+ *set before a pin turns into an output*/
+#define _MCP230XX_GPPU 0
+#define _MCP230XX_OLAT 1
+#define _MCP230XX_IODIR 2
+#define _MCP230XX_SHADOWS 3
+#define _MCP230XX_MAX_PORTS 2
+
+/*Parts - ports*/
+#define MCP23017(i2c_address) {i2c_address, 2}
+#define MCP23008(i2c_address) {i2c_address, 1}
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  MCP230XX_OK,
+  MCP230XX_GENERIC_ERROR
+}MCP230XX_Status_Enum_t;
+
+/*Expander pins - the MCP23008's GP0-GP7 are GPA0-GPA7*/
+typedef enum
+{
+  MCP230XX_GPA0, MCP230XX_GPA1, MCP230XX_GPA2, MCP230XX_GPA3,
+  MCP230XX_GPA4, MCP230XX_GPA5, MCP230XX_GPA6, MCP230XX_GPA7,
+  MCP230XX_GPB0, MCP230XX_GPB1, MCP230XX_GPB2, MCP230XX_GPB3,
+  MCP230XX_GPB4, MCP230XX_GPB5, MCP230XX_GPB6, MCP230XX_GPB7,
+  MCP230XX_MAX_PINS
+}MCP230XX_Pins_t;
+
+/*One per expander, owned by the application - declare with MCP23017() or
+ *MCP23008(), the shadows are set up by Initialize*/
+typedef struct
+{
+  uint8_t i2c_address;                                      //7-bit
+  uint8_t ports;                                            //1 or 2
+  uint8_t shadow[_MCP230XX_SHADOWS][_MCP230XX_MAX_PORTS];   //What the application has asked for
+  uint8_t chip[_MCP230XX_SHADOWS][_MCP230XX_MAX_PORTS];     //What the chip was last sent
+}MCP230XX_Device_t;
+
+/******************************************************************************
+***** MCP230XX Interface
+*******************************************************************************/
+typedef struct {
+  MCP230XX_Status_Enum_t (*Initialize)(MCP230XX_Device_t *device);
+  void (*ModeSet)(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin, PinDirectionEnum_t PinDirection);
+  void (*PinWrite)(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin, LogicEnum_t PinLevel);
+  void (*PinToggle)(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin);
+  LogicEnum_t (*PinRead)(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin);
+  MCP230XX_Status_Enum_t (*Flush)(MCP230XX_Device_t *device);
+  MCP230XX_Status_Enum_t (*ReadPorts)(MCP230XX_Device_t *device, uint16_t *levels);
+}MCP230XX_Interface_t;
+
+extern const MCP230XX_Interface_t MCP230XX;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+MCP230XX_Status_Enum_t MCP230XX_Init(MCP230XX_Device_t *device);
+void MCP230XX_SetDirection(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin, PinDirectionEnum_t PinDirection);
+void MCP230XX_WritePin(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin, LogicEnum_t PinLevel);
+void MCP230XX_TogglePin(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin);
+LogicEnum_t MCP230XX_ReadPin(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin);
+MCP230XX_Status_Enum_t MCP230XX_Flush(MCP230XX_Device_t *device);
+MCP230XX_Status_Enum_t MCP230XX_ReadPorts(MCP230XX_Device_t *device, uint16_t *levels);
+
+#endif /*_COREMCU_MCP230XX_H*/
+
+/*** End of File **************************************************************/
@@ -0,0 +1,194 @@
+/****************************************************************************
+* Title                 :   Binary Telemetry - COBS Framed, CRC16 Checked
+* Filename              :   telemetry.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "telemetry.h"
+
+/******************************************************************************
+* Interface
+*******************************************************************************/
+const TELEMETRY_Interface_t TELEMETRY = {
+  .Send = &TELEMETRY_Send,
+  .CRC16 = &TELEMETRY_CRC16_Update,
+};
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+/*CRC-16/CCITT nibble table - 32 bytes of flash instead of 512 for a full table*/
+const uint16_t TELEMETRY_CRC16_Table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+/*Describes the frame being encoded - Payload points at the callers data, nothing is copied*/
+typedef struct
+{
+    uint8_t message_id;
+    const uint8_t *payload;
+    uint8_t payload_length;
+    uint8_t crc[2];
+    uint8_t frame_length;
+}TELEMETRY_Frame_t;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t TELEMETRY_Frame_Byte(TELEMETRY_Frame_t *frame, uint8_t index);
+uint8_t TELEMETRY_Frame_Run_Length(TELEMETRY_Frame_t *frame, uint8_t index);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : TELEMETRY_Send()
+* Description: Sends a message as a COBS framed, CRC checked binary frame on SERIAL1.
+* The payload is encoded directly from the callers memory while it is being
+* transmitted, so no frame buffer is needed.
+*
+* Parameters:
+*   - message_id (uint8_t): Application defined message ID.
+*   - payload (const void*): Pointer to the data to send, usually a struct.
+*   - length (uint8_t): Number of payload bytes, up to _TELEMETRY_MAX_PAYLOAD.
+*
+* Returns:
+*   - TELEMETRY_Status_Enum_t: TELEMETRY_OK, TELEMETRY_PAYLOAD_TOO_LARGE or
+*     TELEMETRY_SERIAL_ERROR if SERIAL1 timed out.
+*
+* Example:
+*   typedef struct {uint16_t pot; uint16_t ldr;} Sample_t;
+*   Sample_t sample;
+*   TELEMETRY.Send(0x01, &sample, sizeof(sample));
+*******************************************************************************/
+TELEMETRY_Status_Enum_t TELEMETRY_Send(uint8_t message_id, const void *payload, uint8_t length)
+{
+  TELEMETRY_Frame_t frame;
+  uint16_t crc;
+  uint8_t index = 0;
+  uint8_t run;
+  
+  if (length > _TELEMETRY_MAX_PAYLOAD){return TELEMETRY_PAYLOAD_TOO_LARGE;}
+  
+  frame.message_id = message_id;
+  frame.payload = (const uint8_t *)payload;
+  frame.payload_length = length;
+  frame.frame_length = length + 3;  //ID + Payload + CRC
+  
+  crc = TELEMETRY_CRC16_Update(_TELEMETRY_CRC16_INIT, &message_id, 1);
+  crc = TELEMETRY_CRC16_Update(crc, frame.payload, length);
+  frame.crc[0] = (uint8_t)(crc >> 8);
+  frame.crc[1] = (uint8_t)(crc);
+  
+  // COBS - Each block is a code byte (run length + 1) followed by the non-zero run.
+  // The frame is never longer than 254 bytes so a run always ends at a zero or the end.
+  for (;;) {
+    run = TELEMETRY_Frame_Run_Length(&frame, index);
+    
+    if (SERIAL1.WriteByte(run + 1) != OK){return TELEMETRY_SERIAL_ERROR;}
+    for (uint8_t i = 0; i < run; i++) {
+        if (SERIAL1.WriteByte(TELEMETRY_Frame_Byte(&frame, index + i)) != OK){return TELEMETRY_SERIAL_ERROR;}
+    }
+    
+    index += run;
+    if (index >= frame.frame_length){break;}
+    index++;  //Skip the zero - it is implied by the code byte
+  }
+  
+  if (SERIAL1.WriteByte(_TELEMETRY_FRAME_DELIMITER) != OK){return TELEMETRY_SERIAL_ERROR;}
+  return TELEMETRY_OK;
+}
+
+/******************************************************************************
+* Function : TELEMETRY_Frame_Byte()
+* Description: Returns the byte at a position in the unencoded frame 
+* (ID, Payload, CRC High, CRC Low) without assembling the frame in RAM.
+*
+*******************************************************************************/
+uint8_t TELEMETRY_Frame_Byte(TELEMETRY_Frame_t *frame, uint8_t index)
+{
+  if (index == 0){return frame->message_id;}
+  index--;
+  if (index < frame->payload_length){return frame->payload[index];}
+  return frame->crc[index - frame->payload_length];
+}
+
+/******************************************************************************
+* Function : TELEMETRY_Frame_Run_Length()
+* Description: Counts the non-zero bytes starting at index, stopping at the next 
+* zero or the end of the frame.
+*
+*******************************************************************************/
+uint8_t TELEMETRY_Frame_Run_Length(TELEMETRY_Frame_t *frame, uint8_t index)
+{
+  uint8_t run = 0;
+  
+  while ((uint8_t)(index + run) < frame->frame_length && TELEMETRY_Frame_Byte(frame, index + run) != 0) {
+      run++;
+  }
+  return run;
+}
+
+/******************************************************************************
+* Function : TELEMETRY_CRC16_Update()
+* Description: Updates a CRC-16/CCITT-FALSE value with a block of data, one nibble
+* at a time. Start with _TELEMETRY_CRC16_INIT.
+*
+* Parameters:
+*   - crc (uint16_t): Current CRC value.
+*   - data (const uint8_t*): Data to add to the CRC.
+*   - length (uint8_t): Number of bytes.
+*
+* Returns:
+*   - uint16_t: Updated CRC value.
+*******************************************************************************/
+uint16_t TELEMETRY_CRC16_Update(uint16_t crc, const uint8_t *data, uint8_t length)
+{
+  while (length--) {
+      crc = (uint16_t)(crc << 4) ^ TELEMETRY_CRC16_Table[(uint8_t)(crc >> 12) ^ (*data >> 4)];
+      crc = (uint16_t)(crc << 4) ^ TELEMETRY_CRC16_Table[(uint8_t)(crc >> 12) ^ (*data & 0x0F)];
+      data++;
+  }
+  return crc;
+}
+
+/*** End of File **************************************************************/
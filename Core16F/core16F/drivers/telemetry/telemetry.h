@@ -0,0 +1,104 @@
+/****************************************************************************
+* Title                 :   Binary Telemetry - COBS Framed, CRC16 Checked
+* Filename              :   telemetry.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+#ifndef _COREMCU_TELEMETRY_H
+#define _COREMCU_TELEMETRY_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core_version.h"
+
+#ifdef _CORE16_MCU
+    #include "../../core16F.h"
+#endif
+
+#ifdef _CORE18_MCU
+	#include "../../core18F.h"
+#endif
+
+/******************************************************************************
+* Frame Format
+*
+* Each message is sent on SERIAL1 as one COBS encoded frame followed by a
+* single 0x00 delimiter:
+*
+*   COBS( [Message ID] [Payload 0..n] [CRC16 High] [CRC16 Low] ) 0x00
+*
+* The CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) computed over the
+* message ID and payload. The payload is sent exactly as it sits in memory, 
+* XC8 is little endian and does not pad structures.
+*
+* Tools/telemetry_decode.py is the matching host side decoder.
+*******************************************************************************/
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+#define _TELEMETRY_FRAME_DELIMITER 0x00
+#define _TELEMETRY_CRC16_INIT 0xFFFF
+#define _TELEMETRY_MAX_PAYLOAD 250    //Keeps the frame under 254 bytes so a COBS run never splits
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  TELEMETRY_OK,
+  TELEMETRY_PAYLOAD_TOO_LARGE,
+  TELEMETRY_SERIAL_ERROR
+}TELEMETRY_Status_Enum_t;
+
+/******************************************************************************
+***** TELEMETRY Interface
+*******************************************************************************/
+typedef struct {
+  TELEMETRY_Status_Enum_t (*Send)(uint8_t message_id, const void *payload, uint8_t length);
+  uint16_t (*CRC16)(uint16_t crc, const uint8_t *data, uint8_t length);
+}TELEMETRY_Interface_t;
+
+extern const TELEMETRY_Interface_t TELEMETRY;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+TELEMETRY_Status_Enum_t TELEMETRY_Send(uint8_t message_id, const void *payload, uint8_t length);
+uint16_t TELEMETRY_CRC16_Update(uint16_t crc, const uint8_t *data, uint8_t length);
+
+#endif /*_COREMCU_TELEMETRY_H*/
+
+/*** End of File **************************************************************/
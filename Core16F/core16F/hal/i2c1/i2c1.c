@@ -34,6 +34,11 @@
 *   Date        Version Author          Description 
 *   2024/08/15  1.0.0   Jamie Starling  Initial Version
 *   2024/11/03  1.0.4   Jamie Starling  Changed to Match the 18F I2C Interface
+*   2026/10/18  1.1.0   Jamie Starling  Bus speed and SDA hold computed from _I2C1_BUS_SPEED_HZ
+*   2026/10/18  1.2.0   Jamie Starling  WriteVector - scatter-gather writes, WriteData is a single segment
+*   2026/10/18  1.3.0   Jamie Starling  Bus recovery replaces the 25ms reset delay, recovery statistics
+*   2026/10/18  1.4.0   Jamie Starling  Microsecond timeouts set per transaction, NACK/timeout/collision statistics
+*   2026/10/18  1.5.0   Jamie Starling  ReadData - repeated start between write and read, last byte NACKed
 *
 *****************************************************************************/
 
@@ -50,19 +55,32 @@ const I2C1_Master_Interface_t I2C1_MASTER = {
   .BusReset = &MASTER_I2C1_Reset,
   .WriteData = &MASTER_I2C1_WriteData,
   .ReadData = &MASTER_I2C1_ReadData,  
+  .WriteVector = &MASTER_I2C1_WriteVector,
+  .SetTimeout = &MASTER_I2C1_SetTimeout,
+  .GetStats = &MASTER_I2C1_GetStats,
+  .ClearStats = &MASTER_I2C1_ClearStats,
 };
 
+/******************************************************************************
+* Variables
+*******************************************************************************/
+I2C1_Stats_t I2C1_Stats;
+uint16_t I2C1_Timeout_US = _I2C1_DEFAULT_TIMEOUT_US;
+
 /******************************************************************************
 * Function Prototypes
 *******************************************************************************/
 
+void I2C1_Bus_Recover(void);
 void I2C1_Clear_Interrupt(void);
 void MASTER_I2C1_Send_Start_Bit_BLOCKING(void);
 void MASTER_I2C1_Send_Stop_BLOCKING(void);
 I2C1_Status_Enum_t MASTER_I2C1_Send_Byte_BLOCKING(uint8_t data);
 I2C1_Status_Enum_t I2C1_Wait_Until_Complete(void);
+I2C1_Status_Enum_t I2C1_Wait_Bit_Clear(volatile uint8_t *bit_register, uint8_t bit_mask);
 bool I2C1_IsBusy(void);
-uint8_t MASTER_I2C1_Receive_Byte_BLOCKING(void);
+void MASTER_I2C1_Send_Restart_BLOCKING(void);
+I2C1_Status_Enum_t MASTER_I2C1_Receive_Byte_BLOCKING(uint8_t *data, bool last_byte);
 
 /******************************************************************************
 * Functions
@@ -78,30 +96,42 @@ uint8_t MASTER_I2C1_Receive_Byte_BLOCKING(void);
 *******************************************************************************/
 void MASTER_I2C1_Init(void)
 {
-  GPIO_SetDirection(I2C1_CLOCK_PIN,INPUT);
-  GPIO_SetDirection(I2C1_DATA_PIN,INPUT);  
- 
-  PPS_MapBiDirection(I2C1_CLOCK_PIN,PPSOUT_SCK1_SCL1,&SSP1CLKPPS);
-  PPS_MapBiDirection(I2C1_DATA_PIN,PPSOUT_SDO1_SDA1,&SSP1DATPPS);
+  I2C1_Map_Pins();
     
-  SSP1STAT = 0x80; /* CKE disabled; SMP Standard Speed;  */  
+  SSP1STAT = _I2C1_SSP1STAT; /* CKE disabled; SMP for the bus speed;  */  
   SSP1CON1 = 0x8; /* SSPM FOSC/4_SSPxADD_I2C; CKP disabled; SSPEN disabled; SSPOV no_overflow; WCOL no_collision;  */  
   SSP1CON2 = 0x0; /* SEN disabled; RSEN disabled; PEN disabled; RCEN disabled; ACKEN disabled; ACKDT acknowledge; GCEN disabled;  */  
-  SSP1CON3 = 0x0; /* DHEN disabled; AHEN disabled; SBCDE disabled; SDAHT 100ns; BOEN disabled; SCIE disabled; PCIE disabled;  */
+  SSP1CON3 = 0x0; /* DHEN disabled; AHEN disabled; SBCDE disabled; BOEN disabled; SCIE disabled; PCIE disabled;  */
+  SSP1CON3bits.SDAHT = _I2C1_SDA_HOLD;
   SSP1CON1bits.SSPM = 0b1000;  
-  SSP1ADD = 0x4F;    /* SSPADD 79;  */  
+  SSP1ADD = _I2C1_BAUD_VALUE;    /* Computed from _I2C1_BUS_SPEED_HZ - 79 for 100kHz at 32MHz */  
   MASTER_I2C1_Reset();
 }
 
 
+/******************************************************************************
+* Function : I2C1_Map_Pins()
+* Description: SCL and SDA as inputs, mapped to the MSSP.
+*
+*******************************************************************************/
+void I2C1_Map_Pins(void)
+{
+  GPIO_SetDirection(I2C1_CLOCK_PIN,INPUT);
+  GPIO_SetDirection(I2C1_DATA_PIN,INPUT);  
+ 
+  PPS_MapBiDirection(I2C1_CLOCK_PIN,PPSOUT_SCK1_SCL1,&SSP1CLKPPS);
+  PPS_MapBiDirection(I2C1_DATA_PIN,PPSOUT_SDO1_SDA1,&SSP1DATPPS);
+}
+
 /******************************************************************************
 * Function : MASTER_I2C1_Reset()
 * Description: This function resets the I2C1 module in master mode. It disables the I2C1 module, 
 * clears any overflows or write collisions, and flushes the buffer. It also clears 
-* the MSSP1 interrupt flag to ensure the I2C bus is reset to a known state.
+* the MSSP1 interrupt flag. The bus is then checked and recovered if a target
+* is holding SDA low.
 *
 * After performing these actions, the function re-enables the I2C1 module to allow 
-* it to resume normal operation.
+* it to resume normal operation. An idle bus costs a few microseconds.
 *
 *******************************************************************************/
 void MASTER_I2C1_Reset(void)
@@ -111,10 +141,116 @@ void MASTER_I2C1_Reset(void)
   temp = SSP1BUF;
   SSP1CON1bits.WCOL = 0;  
   I2C1_Clear_Interrupt();  //Clear SSP1IF
-  __delay_ms(_I2C1_RESET_DELAY_MS);
+  I2C1_Bus_Recover();
   SSP1CON1bits.SSPEN = 1;
 }
 
+/******************************************************************************
+* Function : I2C1_Bus_Recover()
+* Description: Takes the pins back from the MSSP and checks the bus. A target
+* reset part way through a read can hold SDA low waiting for clocks - SCL is
+* clocked by hand until it lets go (9 clocks at most), then a Stop is sent.
+* The pins are mapped back to the MSSP when done.
+*
+*******************************************************************************/
+void I2C1_Bus_Recover(void)
+{
+  /*Pins follow LAT (PPS output 0) - open drain, so HIGH releases the line*/
+  *(GPIO_Register_LU[I2C1_CLOCK_PIN].pps_output_reg) = 0x00;
+  *(GPIO_Register_LU[I2C1_DATA_PIN].pps_output_reg) = 0x00;
+  GPIO_WritePortPin(I2C1_CLOCK_PIN,HIGH);
+  GPIO_WritePortPin(I2C1_DATA_PIN,HIGH);
+  GPIO_SetDirection(I2C1_CLOCK_PIN,OPEN_DRAIN);
+  GPIO_SetDirection(I2C1_DATA_PIN,OPEN_DRAIN);
+  __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+  
+  if ((GPIO_ReadPortPin(I2C1_DATA_PIN) == LOW) || (GPIO_ReadPortPin(I2C1_CLOCK_PIN) == LOW)) {
+      for (uint8_t clock = 0; (clock < _I2C1_RECOVERY_CLOCKS) && (GPIO_ReadPortPin(I2C1_DATA_PIN) == LOW); clock++) {
+          GPIO_WritePortPin(I2C1_CLOCK_PIN,LOW);
+          __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+          GPIO_WritePortPin(I2C1_CLOCK_PIN,HIGH);
+          __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+      }
+      
+      /*Stop - SDA rises while SCL is high*/
+      GPIO_WritePortPin(I2C1_CLOCK_PIN,LOW);
+      GPIO_WritePortPin(I2C1_DATA_PIN,LOW);
+      __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+      GPIO_WritePortPin(I2C1_CLOCK_PIN,HIGH);
+      __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+      GPIO_WritePortPin(I2C1_DATA_PIN,HIGH);
+      __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+      
+      if ((GPIO_ReadPortPin(I2C1_DATA_PIN) == HIGH) && (GPIO_ReadPortPin(I2C1_CLOCK_PIN) == HIGH)){I2C1_Stats.recoveries++;}
+      else {I2C1_Stats.recovery_failures++;}
+  }
+  
+  I2C1_Map_Pins();
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_SetTimeout()
+* Description: Sets how long a transfer may wait for the bus to move on before
+* giving up with I2C_TIMEOUT. Applies to the calls that follow - set it before
+* a transaction with a slow, clock stretching target and put it back after.
+*
+* Parameters:
+*   - timeout_us (uint16_t): Timeout in microseconds, 4us resolution.
+*******************************************************************************/
+void MASTER_I2C1_SetTimeout(uint16_t timeout_us)
+{
+  I2C1_Timeout_US = timeout_us;
+}
+
+/******************************************************************************
+* Function : I2C1_Record_Status()
+* Description: Counts failed transfers by cause and hands the status back, so
+* return paths can be wrapped in it.
+*
+*******************************************************************************/
+I2C1_Status_Enum_t I2C1_Record_Status(I2C1_Status_Enum_t status)
+{
+  switch (status) {
+      case I2C_ADDRESS_INVALID: I2C1_Stats.address_nacks++; break;
+      case I2C_NACK_RECEIVED: I2C1_Stats.nacks++; break;
+      case I2C_TIMEOUT: I2C1_Stats.timeouts++; break;
+      case I2C_BUS_COLLISION: I2C1_Stats.collisions++; break;
+      default: break;
+  }
+  return status;
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_GetStats()
+* Description: Copies the bus statistics. The counters wrap - clear them after
+* reading to measure over an interval.
+*
+* Parameters:
+*   - stats (I2C1_Stats_t*): Filled with the current counters.
+*******************************************************************************/
+void MASTER_I2C1_GetStats(I2C1_Stats_t *stats)
+{
+  uint8_t gie_state = INTCONbits.GIE;   //Restored, not forced on - safe inside a critical section
+  
+  INTCONbits.GIE = 0;   //The async engine counts from its ISR
+  *stats = I2C1_Stats;
+  INTCONbits.GIE = gie_state;
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_ClearStats()
+* 
+*******************************************************************************/
+void MASTER_I2C1_ClearStats(void)
+{
+  I2C1_Stats.address_nacks = 0;
+  I2C1_Stats.nacks = 0;
+  I2C1_Stats.timeouts = 0;
+  I2C1_Stats.collisions = 0;
+  I2C1_Stats.recoveries = 0;
+  I2C1_Stats.recovery_failures = 0;
+}
+
 /******************************************************************************
 * Function : MASTER_I2C1_WriteData()
 * Description: Writes a block of data to a specified I2C address. Sends the start condition,
@@ -132,7 +268,34 @@ void MASTER_I2C1_Reset(void)
 *******************************************************************************/
 I2C1_Status_Enum_t MASTER_I2C1_WriteData(uint8_t i2c_address,uint8_t i2c_bytecount, uint8_t *datablock)
 {
-  //Check for Busy...
+  I2C1_Segment_t segment = {datablock, i2c_bytecount};
+  
+  return MASTER_I2C1_WriteVector(i2c_address, &segment, 1);
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_WriteVector()
+* Description: Writes a list of segments to a specified I2C address as one
+* transaction - Start, address, every byte of every segment, Stop. A register
+* address and its payload can be sent from separate buffers without copying
+* them together first.
+*
+* Parameters:
+*   - i2c_address (uint8_t): The I2C address of the device to write to.
+*   - segments (const I2C1_Segment_t*): Segments in the order they go on the bus.
+*   - segment_count (uint8_t): Number of segments, empty segments are skipped.
+*
+* Returns:
+*   - I2C1_Status_Enum_t: I2C_OK, I2C_ADDRESS_INVALID, I2C_NACK_RECEIVED or I2C_TIMEOUT.
+*
+* Example:
+*   uint8_t reg = 0x40;
+*   I2C1_Segment_t write[2] = {{&reg, 1}, {settings, sizeof(settings)}};
+*   I2C1_MASTER.WriteVector(0x20, write, 2);
+*******************************************************************************/
+I2C1_Status_Enum_t MASTER_I2C1_WriteVector(uint8_t i2c_address, const I2C1_Segment_t *segments, uint8_t segment_count)
+{
+  I2C1_Status_Enum_t status;
   
   // Send start condition
   MASTER_I2C1_Send_Start_Bit_BLOCKING(); 
@@ -140,10 +303,11 @@ I2C1_Status_Enum_t MASTER_I2C1_WriteData(uint8_t i2c_address,uint8_t i2c_bytecou
   // Send I2C Address with R/W bit cleared (write operation)
   SSP1BUF = (uint8_t)(i2c_address << 1);  
   
-  // Wait for the address to be transmitted or timeout
-  if (I2C1_Wait_Until_Complete() == I2C_TIMEOUT){
+  // Wait for the address to be transmitted, timeout or collision
+  status = I2C1_Wait_Until_Complete();
+  if (status != I2C_OK){
       MASTER_I2C1_Send_Stop_BLOCKING();
-      return I2C_TIMEOUT;
+      return I2C1_Record_Status(status);
     }  
   
   I2C1_Clear_Interrupt();  // Clear interrupt flag
@@ -151,26 +315,19 @@ I2C1_Status_Enum_t MASTER_I2C1_WriteData(uint8_t i2c_address,uint8_t i2c_bytecou
  // Check for ACK from the client
   if(SSP1CON2bits.ACKSTAT){
       MASTER_I2C1_Send_Stop_BLOCKING(); // Send Stop if NACK is received
-      return I2C_ADDRESS_INVALID;
+      return I2C1_Record_Status(I2C_ADDRESS_INVALID);
     }
   
-  // If no data to send (address check only)
-  if(i2c_bytecount==0){
-    MASTER_I2C1_Send_Stop_BLOCKING();
-    return I2C_OK;  
-    }
-  
-  // Send each byte in the data block
-  for (uint8_t i2c_bytecounter = 0; i2c_bytecounter < i2c_bytecount; i2c_bytecounter++){    
-    I2C1_Status_Enum_t transmit_status;
-    transmit_status = MASTER_I2C1_Send_Byte_BLOCKING(datablock[i2c_bytecounter]); // Send each byte individually
-    
-    // Check for NACK or other issues
-    if (transmit_status != I2C_ACK_RECEIVED)
-      {
-        MASTER_I2C1_Send_Stop_BLOCKING();
-        return I2C_NACK_RECEIVED;       
-      }    
+  // Send each byte of each segment - no segments is an address check
+  for (uint8_t segment = 0; segment < segment_count; segment++){
+    for (uint8_t i2c_bytecounter = 0; i2c_bytecounter < segments[segment].length; i2c_bytecounter++){
+      status = MASTER_I2C1_Send_Byte_BLOCKING(segments[segment].data[i2c_bytecounter]);
+      if (status != I2C_ACK_RECEIVED)
+        {
+          MASTER_I2C1_Send_Stop_BLOCKING();
+          return I2C1_Record_Status(status);       
+        }    
+      }
     }
   
   // Send Stop Bit after the last byte
@@ -186,11 +343,10 @@ I2C1_Status_Enum_t MASTER_I2C1_WriteData(uint8_t i2c_address,uint8_t i2c_bytecou
 *******************************************************************************/
 void MASTER_I2C1_Send_Start_Bit_BLOCKING(void)
 {
-  uint8_t timeout_counter = _I2C1_BUS_TIMEOUT_VALUE; 
   SSP1CON2bits.SEN = 1;
    
-   while(SSP1CON2bits.SEN && timeout_counter-- > 0){}
-   I2C1_Clear_Interrupt();  //Clear SSP1IF
+  I2C1_Wait_Bit_Clear(&SSP1CON2, _SSP1CON2_SEN_MASK);  //A stuck Start shows up as a timeout on the address
+  I2C1_Clear_Interrupt();  //Clear SSP1IF
 }
 
 /******************************************************************************
@@ -202,9 +358,8 @@ void MASTER_I2C1_Send_Start_Bit_BLOCKING(void)
 *******************************************************************************/
 void MASTER_I2C1_Send_Stop_BLOCKING(void)
 {
-  uint8_t timeout_counter = _I2C1_BUS_TIMEOUT_VALUE; 
   SSP1CON2bits.PEN = 1;
-  while(SSP1CON2bits.PEN && timeout_counter-- > 0){}
+  I2C1_Wait_Bit_Clear(&SSP1CON2, _SSP1CON2_PEN_MASK);
   I2C1_Clear_Interrupt();
 }
 
@@ -219,13 +374,16 @@ void MASTER_I2C1_Send_Stop_BLOCKING(void)
 *
 * Returns:
 *   - I2C1_Status_Enum_t: Status of the transmission (e.g., I2C_ACK_RECEIVED, 
-*     I2C_NACK_RECEIVED, I2C_TIMEOUT).
+*     I2C_NACK_RECEIVED, I2C_TIMEOUT, I2C_BUS_COLLISION).
 *
 *******************************************************************************/
 I2C1_Status_Enum_t MASTER_I2C1_Send_Byte_BLOCKING(uint8_t data)
 {
+  I2C1_Status_Enum_t status;
+  
   SSP1BUF = data;  
-  if (I2C1_Wait_Until_Complete() == I2C_TIMEOUT){return I2C_TIMEOUT;} //Wait until complete or timeout
+  status = I2C1_Wait_Until_Complete(); //Wait until complete, timeout or collision
+  if (status != I2C_OK){return status;}
   I2C1_Clear_Interrupt();  // Clear the interrupt flag
   
   // Check for ACK from the slave device
@@ -260,28 +418,51 @@ bool I2C1_IsBusy(void)
 /******************************************************************************
 * Function : I2C1_Wait_Until_Complete()
 * Description: Waits for the I2C1 module to complete its current operation. Returns a 
-* status indicating whether the operation finished successfully or timed out.
+* status indicating whether the operation finished successfully, timed out on
+* the system timer or lost the bus.
 *
 *
 * Returns:
-*   - I2C1_Status_Enum_t: `I2C_OK` if the operation completes, `I2C_TIMEOUT` if it times out.
+*   - I2C1_Status_Enum_t: `I2C_OK` if the operation completes, `I2C_TIMEOUT` if it times out,
+*     `I2C_BUS_COLLISION` on a collision.
 *  
 *******************************************************************************/
 I2C1_Status_Enum_t I2C1_Wait_Until_Complete(void)
 {
-  uint8_t timeout_counter = _I2C1_BUS_TIMEOUT_VALUE; 
+  uint32_t start_time = ISR_CORE16F_SYSTEM_TIMER_GetMicros();
   
-  while (I2C1_IsBusy() && timeout_counter-- > 0){} //wait until complete or time out    
-  return (timeout_counter == 0) ? I2C_TIMEOUT : I2C_OK;
+  while (I2C1_IsBusy()){
+      if (PIR3bits.BCL1IF){return I2C_BUS_COLLISION;}
+      if ((ISR_CORE16F_SYSTEM_TIMER_GetMicros() - start_time) > I2C1_Timeout_US){return I2C_TIMEOUT;}
+    }
+  return I2C_OK;
+}
+
+/******************************************************************************
+* Function : I2C1_Wait_Bit_Clear()
+* Description: Waits for the MSSP to clear a control bit (SEN, PEN...) once the
+* bus condition is sent, up to the timeout.
+*
+* Returns:
+*   - I2C1_Status_Enum_t: `I2C_OK` or `I2C_TIMEOUT`.
+*******************************************************************************/
+I2C1_Status_Enum_t I2C1_Wait_Bit_Clear(volatile uint8_t *bit_register, uint8_t bit_mask)
+{
+  uint32_t start_time = ISR_CORE16F_SYSTEM_TIMER_GetMicros();
+  
+  while (*bit_register & bit_mask){
+      if ((ISR_CORE16F_SYSTEM_TIMER_GetMicros() - start_time) > I2C1_Timeout_US){return I2C_TIMEOUT;}
+    }
+  return I2C_OK;
 }
 
 /******************************************************************************
 * Function : MASTER_I2C1_ReadData()
-* Description:  This function reads data from an I2C device in master mode. It sends a start 
-* condition, writes an address with the read bit set, transmits a series of data 
-* bytes (if any), and then reads a specified number of bytes from the slave device. 
-* The function handles potential NACKs and timeouts, ensuring that the I2C operation 
-* completes safely or returns an error code.
+* Description:  This function reads data from an I2C device in master mode. The
+* send bytes (usually a register address) are written first, then a repeated
+* start turns the bus around and the receive bytes are read. Every byte but the
+* last is ACKed, the last is NACKed so the target lets go of SDA before the Stop.
+* With no send bytes the read starts straight after the Start.
 *
 * @param[in] i2c_address - The 7-bit address of the I2C slave device.
 * @param[in] i2c_bytecount_send - Number of bytes to send to the slave device.
@@ -294,48 +475,47 @@ I2C1_Status_Enum_t I2C1_Wait_Until_Complete(void)
 *    - I2C_TIMEOUT: Timeout occurred while waiting for a response.
 *    - I2C_ADDRESS_INVALID: The slave device did not acknowledge the address.
 *    - I2C_NACK_RECEIVED: The slave device did not acknowledge the transmitted data.
+*    - I2C_BUS_COLLISION: The bus was lost.
 *******************************************************************************/
 I2C1_Status_Enum_t MASTER_I2C1_ReadData(uint8_t i2c_address,uint8_t i2c_bytecount_send, uint8_t *datablock_send, uint8_t i2c_bytecount_receive, uint8_t *datablock_receive)
 {
-    
-  if(I2C1_IsBusy()){return I2C_Busy;}
+  I2C1_Status_Enum_t status = I2C_ACK_RECEIVED;
   
-  // Send start condition
-  MASTER_I2C1_Send_Start_Bit_BLOCKING(); 
- 
-  // Send I2C Address with R/W bit set (read operation)
-  SSP1BUF = (uint8_t)(uint8_t)(i2c_address << 1 | 1);
-  
-  // Wait for the address to be transmitted or timeout
-  if (I2C1_Wait_Until_Complete() == I2C_TIMEOUT){
-      MASTER_I2C1_Send_Stop_BLOCKING();
-      return I2C_TIMEOUT;
-    }  
+  if (i2c_bytecount_receive == 0){return MASTER_I2C1_WriteData(i2c_address, i2c_bytecount_send, datablock_send);}
   
-  I2C1_Clear_Interrupt();  // Clear interrupt flag
+  MASTER_I2C1_Send_Start_Bit_BLOCKING();
   
- // Check for ACK from the client
-  if(SSP1CON2bits.ACKSTAT){
-      MASTER_I2C1_Send_Stop_BLOCKING(); // Send Stop if NACK is received
-      return I2C_ADDRESS_INVALID;
+  // Write phase - address with the R/W bit clear, then the send bytes
+  if (i2c_bytecount_send > 0){
+    status = MASTER_I2C1_Send_Byte_BLOCKING((uint8_t)(i2c_address << 1));
+    if (status == I2C_NACK_RECEIVED){status = I2C_ADDRESS_INVALID;}
+    
+    for (uint8_t i2c_bytecounter = 0; (i2c_bytecounter < i2c_bytecount_send) && (status == I2C_ACK_RECEIVED); i2c_bytecounter++){
+      status = MASTER_I2C1_Send_Byte_BLOCKING(datablock_send[i2c_bytecounter]);
+      }
+    
+    if (status != I2C_ACK_RECEIVED){
+      MASTER_I2C1_Send_Stop_BLOCKING();
+      return I2C1_Record_Status(status);
+      }
+    
+    MASTER_I2C1_Send_Restart_BLOCKING();
     }
   
-  // Send each byte in the data block
-  for (uint8_t i2c_bytecounter = 0; i2c_bytecounter < i2c_bytecount_send; i2c_bytecounter++){    
-    I2C1_Status_Enum_t transmit_status;
-    transmit_status = MASTER_I2C1_Send_Byte_BLOCKING(datablock_send[i2c_bytecounter]); // Send each byte individually
-    
-    // Check for NACK or other issues
-    if (transmit_status != I2C_ACK_RECEIVED)
-      {
-        MASTER_I2C1_Send_Stop_BLOCKING();
-        return I2C_NACK_RECEIVED;       
-      }    
+  // Read phase - address with the R/W bit set
+  status = MASTER_I2C1_Send_Byte_BLOCKING((uint8_t)((i2c_address << 1) | 0x01));
+  if (status != I2C_ACK_RECEIVED){
+      MASTER_I2C1_Send_Stop_BLOCKING();
+      return I2C1_Record_Status((status == I2C_NACK_RECEIVED) ? I2C_ADDRESS_INVALID : status);
     }
   
   // Receive The Data
   for (uint8_t i2c_bytecounter = 0; i2c_bytecounter < i2c_bytecount_receive; i2c_bytecounter++){
-        datablock_receive[i2c_bytecounter] = MASTER_I2C1_Receive_Byte_BLOCKING();
+    status = MASTER_I2C1_Receive_Byte_BLOCKING(&datablock_receive[i2c_bytecounter], (i2c_bytecounter == (uint8_t)(i2c_bytecount_receive - 1)));
+    if (status != I2C_OK){
+        MASTER_I2C1_Send_Stop_BLOCKING();
+        return I2C1_Record_Status(status);
+      }
     } 
   
   // Send Stop Bit after the last byte
@@ -343,34 +523,53 @@ I2C1_Status_Enum_t MASTER_I2C1_ReadData(uint8_t i2c_address,uint8_t i2c_bytecoun
   return I2C_OK;   
 }
 
+/******************************************************************************
+* Function : MASTER_I2C1_Send_Restart_BLOCKING()
+* Description: Sends a repeated start - turns the bus around from write to read
+* without releasing it.
+*
+*******************************************************************************/
+void MASTER_I2C1_Send_Restart_BLOCKING(void)
+{
+  SSP1CON2bits.RSEN = 1;
+  I2C1_Wait_Bit_Clear(&SSP1CON2, _SSP1CON2_RSEN_MASK);
+  I2C1_Clear_Interrupt();
+}
+
 /******************************************************************************
 * Function : MASTER_I2C1_Receive_Byte_BLOCKING()
 * Description: This function receives a single byte of data from an I2C slave device in 
 * a blocking manner using the I2C1 module in master mode. It sets up the I2C 
-* module to receive data, waits for the reception to complete, and returns the 
-* received byte. The function also sends an acknowledgment (ACK) after the byte 
-* is received and clears the appropriate I2C flags.
+* module to receive data, waits for the reception to complete, then sends an
+* ACK - or a NACK for the last byte of the read.
+*
+* Parameters:
+*   - data (uint8_t*): Where the byte is stored.
+*   - last_byte (bool): true to NACK the byte and end the read.
 *
-* @return uint8_t
-*    - The byte of data received from the I2C slave device.
+* Returns:
+*   - I2C1_Status_Enum_t: `I2C_OK`, `I2C_TIMEOUT` or `I2C_BUS_COLLISION`.
 *******************************************************************************/
-uint8_t MASTER_I2C1_Receive_Byte_BLOCKING(void)
+I2C1_Status_Enum_t MASTER_I2C1_Receive_Byte_BLOCKING(uint8_t *data, bool last_byte)
 {
-  uint8_t I2C_Data;  
+  I2C1_Status_Enum_t status;
+  
   I2C1_Clear_Interrupt();  //Clear SSP1IF  
   SSP1CON2bits.RCEN = 1; //Enter Receive Mode
-  I2C1_Wait_Until_Complete(); //wait until complete
-  I2C_Data = SSP1BUF;  
-  SSP1CON2bits.ACKDT = 0;
+  status = I2C1_Wait_Until_Complete();
+  if (status != I2C_OK){return status;}
+  *data = SSP1BUF;  
+  
+  I2C1_Clear_Interrupt();
+  SSP1CON2bits.ACKDT = (last_byte) ? 1 : 0;
   SSP1CON2bits.ACKEN = 1;
-  I2C1_Wait_Until_Complete(); //wait until complete
+  status = I2C1_Wait_Until_Complete(); //wait until the ACK is sent
   I2C1_Clear_Interrupt();  //Clear SSP1IF 
-  SSP1CON2bits.RCEN = 0; //Exit Receive Mode
-  return I2C_Data;
+  SSP1CON2bits.ACKDT = 0;
+  return status;
 }
 
 
 
 
-
 /*** End of File **************************************************************/
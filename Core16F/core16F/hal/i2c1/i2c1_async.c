@@ -0,0 +1,376 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Asynchronous Transaction Engine
+* Filename              :   i2c1_async.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.1.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC16F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  Per transaction timeouts, results counted in the I2C1 statistics
+*  
+*****************************************************************************/
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "i2c1_async.h"
+
+/******************************************************************************
+* I2C1 Async Interface
+*******************************************************************************/
+const I2C1_Async_Interface_t I2C1_ASYNC = {
+  .Initialize = &I2C1_ASYNC_Init,
+  .Submit = &I2C1_ASYNC_Submit,
+  .Service = &I2C1_ASYNC_Service,
+  .IsIdle = &I2C1_ASYNC_IsIdle,
+};
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+/*The MSSP raises SSP1IF once per bus event - the state is the event that just finished*/
+typedef enum
+{
+  I2C1_ASYNC_STATE_START,
+  I2C1_ASYNC_STATE_ADDRESS_WRITE,
+  I2C1_ASYNC_STATE_WRITE,
+  I2C1_ASYNC_STATE_RESTART,
+  I2C1_ASYNC_STATE_ADDRESS_READ,
+  I2C1_ASYNC_STATE_RECEIVE,
+  I2C1_ASYNC_STATE_ACK,
+  I2C1_ASYNC_STATE_STOP
+}I2C1_Async_State_Enum_t;
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+/*Queue indexes - Head is moved by Submit, Active by the ISR and Tail by Service.
+ *Tail..Active are complete and waiting for their callback, Active..Head are waiting for the bus.*/
+I2C1_Transaction_t *I2C1_ASYNC_Queue[_I2C1_ASYNC_QUEUE_SIZE];
+volatile uint8_t I2C1_ASYNC_Head;
+volatile uint8_t I2C1_ASYNC_Active;
+volatile uint8_t I2C1_ASYNC_Tail;
+volatile bool I2C1_ASYNC_Running;
+volatile uint8_t I2C1_ASYNC_Sequence;   //Bumped by the ISR for each transaction started
+
+uint8_t I2C1_ASYNC_Watch_Sequence;      //Transaction being timed by Service
+uint32_t I2C1_ASYNC_Watch_Start;
+
+volatile I2C1_Async_State_Enum_t I2C1_ASYNC_State;
+volatile uint8_t I2C1_ASYNC_Index;
+volatile I2C1_Status_Enum_t I2C1_ASYNC_Result;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void I2C1_ASYNC_Start(void);
+void I2C1_ASYNC_Stop(void);
+void I2C1_ASYNC_Complete(void);
+void I2C1_ASYNC_Check_Timeout(void);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : I2C1_ASYNC_Init()
+* Description: Initializes the I2C1 module, empties the transaction queue and
+* enables interrupts. With the event system enabled completions are delivered
+* from the event loop, otherwise call I2C1_ASYNC_Service() from the main loop.
+*
+* The blocking I2C1_MASTER functions must not be used while a transaction is
+* queued - check I2C1_ASYNC_IsIdle() first.
+*******************************************************************************/
+void I2C1_ASYNC_Init(void)
+{
+  MASTER_I2C1_Init();
+  
+  I2C1_ASYNC_Head = 0;
+  I2C1_ASYNC_Active = 0;
+  I2C1_ASYNC_Tail = 0;
+  I2C1_ASYNC_Running = false;
+  
+  #ifdef _CORE16F_SYSTEM_EVENTS_ENABLE
+    ScheduleEvent(_I2C1_ASYNC_SERVICE_INTERVAL_MS, &I2C1_ASYNC_Service, _I2C1_ASYNC_SERVICE_INTERVAL_MS);
+  #endif
+  
+  ISR_Peripheral_Interrupt(ENABLED);
+  ISR_Global_Interrupt(ENABLED);
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Submit()
+* Description: Queues a transaction and starts it if the bus is idle. Returns
+* straight away, the transaction status stays I2C_Busy until it completes.
+*
+* Parameters:
+*   - transaction (I2C1_Transaction_t*): Caller owned, must stay valid until
+*     the callback runs.
+*
+* Returns:
+*   - I2C1_Status_Enum_t: I2C_OK if queued, I2C_Busy if the queue is full.
+*
+* Example:
+*   uint8_t reg = 0x00;
+*   uint8_t reading[2];
+*   I2C1_Transaction_t sensor = {0x48, &reg, 1, reading, 2, &Sensor_Done};
+*   I2C1_ASYNC.Submit(&sensor);
+*******************************************************************************/
+I2C1_Status_Enum_t I2C1_ASYNC_Submit(I2C1_Transaction_t *transaction)
+{
+  uint8_t next_head = (I2C1_ASYNC_Head + 1) & _I2C1_ASYNC_QUEUE_MASK;
+  uint8_t gie_state;
+  
+  if (next_head == I2C1_ASYNC_Tail){return I2C_Busy;}  //Queue full
+  
+  transaction->status = I2C_Busy;
+  I2C1_ASYNC_Queue[I2C1_ASYNC_Head] = transaction;
+  
+  /*The ISR checks Head when a transaction finishes - hold it off so the
+   *engine can not go idle between moving Head and checking Running*/
+  gie_state = INTCONbits.GIE;
+  INTCONbits.GIE = 0;
+  I2C1_ASYNC_Head = next_head;
+  if (!I2C1_ASYNC_Running) {
+      I2C1_ASYNC_Running = true;
+      I2C1_ASYNC_Start();
+  }
+  INTCONbits.GIE = gie_state;
+  
+  return I2C_OK;
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Service()
+* Description: Runs the callback of each completed transaction, in the order
+* they were submitted. Called from main context - callbacks may submit new
+* transactions.
+*******************************************************************************/
+void I2C1_ASYNC_Service(void)
+{
+  I2C1_Transaction_t *transaction;
+  
+  I2C1_ASYNC_Check_Timeout();
+  
+  while (I2C1_ASYNC_Tail != I2C1_ASYNC_Active) {
+      transaction = I2C1_ASYNC_Queue[I2C1_ASYNC_Tail];
+      I2C1_ASYNC_Tail = (I2C1_ASYNC_Tail + 1) & _I2C1_ASYNC_QUEUE_MASK;
+      if (transaction->callback != NULL){transaction->callback(transaction);}
+  }
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Check_Timeout()
+* Description: Times the transaction on the bus from when Service first sees it.
+* One that overruns its timeout is abandoned - the module is reset (recovering
+* the bus if needed), the transaction completes with I2C_TIMEOUT and the queue
+* moves on.
+*******************************************************************************/
+void I2C1_ASYNC_Check_Timeout(void)
+{
+  uint32_t now;
+  uint16_t timeout_us;
+  uint8_t gie_state;
+  
+  if (!I2C1_ASYNC_Running){return;}
+  
+  now = ISR_CORE16F_SYSTEM_TIMER_GetMicros();
+  if (I2C1_ASYNC_Watch_Sequence != I2C1_ASYNC_Sequence) {
+      I2C1_ASYNC_Watch_Sequence = I2C1_ASYNC_Sequence;
+      I2C1_ASYNC_Watch_Start = now;
+      return;
+  }
+  
+  timeout_us = I2C1_ASYNC_Queue[I2C1_ASYNC_Active]->timeout_us;
+  if (timeout_us == 0){timeout_us = _I2C1_ASYNC_DEFAULT_TIMEOUT_US;}
+  if ((now - I2C1_ASYNC_Watch_Start) <= timeout_us){return;}
+  
+  gie_state = INTCONbits.GIE;
+  INTCONbits.GIE = 0;
+  if (I2C1_ASYNC_Running && (I2C1_ASYNC_Watch_Sequence == I2C1_ASYNC_Sequence)) {  //Did not finish while we looked
+      MASTER_I2C1_Reset();
+      I2C1_ASYNC_Result = I2C_TIMEOUT;
+      I2C1_ASYNC_Complete();
+  }
+  INTCONbits.GIE = gie_state;
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_IsIdle()
+* Description: True when nothing is queued, on the bus or waiting for its callback.
+*******************************************************************************/
+bool I2C1_ASYNC_IsIdle(void)
+{
+  return (I2C1_ASYNC_Tail == I2C1_ASYNC_Head);
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_ISR()
+* Description: MSSP state machine, called from the main ISR. Each SSP1IF means
+* the last bus event finished - check the ACK if there was one and start the next.
+*******************************************************************************/
+void I2C1_ASYNC_ISR(void)
+{
+  I2C1_Transaction_t *transaction = I2C1_ASYNC_Queue[I2C1_ASYNC_Active];
+  
+  if (PIR3bits.BCL1IF) {
+      PIR3bits.BCL1IF = 0;
+      PIR3bits.SSP1IF = 0;
+      I2C1_ASYNC_Result = I2C_BUS_COLLISION;
+      I2C1_ASYNC_Complete();  //Bus lost - MSSP is idle, no Stop to send
+      return;
+  }
+  
+  if (!PIR3bits.SSP1IF){return;}
+  PIR3bits.SSP1IF = 0;
+  
+  switch (I2C1_ASYNC_State) {
+      case I2C1_ASYNC_STATE_START:
+          if ((transaction->write_length == 0) && (transaction->read_length > 0)) {
+              SSP1BUF = (uint8_t)((transaction->address << 1) | 0x01);
+              I2C1_ASYNC_State = I2C1_ASYNC_STATE_ADDRESS_READ;
+          }
+          else {
+              SSP1BUF = (uint8_t)(transaction->address << 1);
+              I2C1_ASYNC_State = I2C1_ASYNC_STATE_ADDRESS_WRITE;
+          }
+          break;
+          
+      case I2C1_ASYNC_STATE_ADDRESS_WRITE:
+      case I2C1_ASYNC_STATE_WRITE:
+          if (SSP1CON2bits.ACKSTAT) {
+              I2C1_ASYNC_Result = (I2C1_ASYNC_State == I2C1_ASYNC_STATE_ADDRESS_WRITE) ? I2C_ADDRESS_INVALID : I2C_NACK_RECEIVED;
+              I2C1_ASYNC_Stop();
+          }
+          else if (I2C1_ASYNC_Index < transaction->write_length) {
+              SSP1BUF = transaction->write_data[I2C1_ASYNC_Index++];
+              I2C1_ASYNC_State = I2C1_ASYNC_STATE_WRITE;
+          }
+          else if (transaction->read_length > 0) {
+              SSP1CON2bits.RSEN = 1;
+              I2C1_ASYNC_State = I2C1_ASYNC_STATE_RESTART;
+          }
+          else {
+              I2C1_ASYNC_Stop();
+          }
+          break;
+          
+      case I2C1_ASYNC_STATE_RESTART:
+          SSP1BUF = (uint8_t)((transaction->address << 1) | 0x01);
+          I2C1_ASYNC_State = I2C1_ASYNC_STATE_ADDRESS_READ;
+          break;
+          
+      case I2C1_ASYNC_STATE_ADDRESS_READ:
+          if (SSP1CON2bits.ACKSTAT) {
+              I2C1_ASYNC_Result = I2C_ADDRESS_INVALID;
+              I2C1_ASYNC_Stop();
+          }
+          else {
+              I2C1_ASYNC_Index = 0;
+              SSP1CON2bits.RCEN = 1;
+              I2C1_ASYNC_State = I2C1_ASYNC_STATE_RECEIVE;
+          }
+          break;
+          
+      case I2C1_ASYNC_STATE_RECEIVE:
+          transaction->read_data[I2C1_ASYNC_Index++] = SSP1BUF;
+          SSP1CON2bits.ACKDT = (I2C1_ASYNC_Index >= transaction->read_length) ? 1 : 0;  //NACK the last byte
+          SSP1CON2bits.ACKEN = 1;
+          I2C1_ASYNC_State = I2C1_ASYNC_STATE_ACK;
+          break;
+          
+      case I2C1_ASYNC_STATE_ACK:
+          if (I2C1_ASYNC_Index < transaction->read_length) {
+              SSP1CON2bits.RCEN = 1;
+              I2C1_ASYNC_State = I2C1_ASYNC_STATE_RECEIVE;
+          }
+          else {
+              I2C1_ASYNC_Stop();
+          }
+          break;
+          
+      case I2C1_ASYNC_STATE_STOP:
+          I2C1_ASYNC_Complete();
+          break;
+  }
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Start()
+* Description: Sets up the transaction at the front of the queue and sends the
+* Start condition - SSP1IF picks it up from there.
+*******************************************************************************/
+void I2C1_ASYNC_Start(void)
+{
+  I2C1_ASYNC_Result = I2C_OK;
+  I2C1_ASYNC_Index = 0;
+  I2C1_ASYNC_Sequence++;
+  I2C1_ASYNC_State = I2C1_ASYNC_STATE_START;
+  
+  PIR3bits.SSP1IF = 0;
+  PIR3bits.BCL1IF = 0;
+  PIE3bits.SSP1IE = 1;
+  PIE3bits.BCL1IE = 1;
+  SSP1CON2bits.SEN = 1;
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Stop()
+* 
+*******************************************************************************/
+void I2C1_ASYNC_Stop(void)
+{
+  SSP1CON2bits.PEN = 1;
+  I2C1_ASYNC_State = I2C1_ASYNC_STATE_STOP;
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Complete()
+* Description: Stores the result, releases the MSSP interrupts and starts the
+* next queued transaction.
+*******************************************************************************/
+void I2C1_ASYNC_Complete(void)
+{
+  PIE3bits.SSP1IE = 0;
+  PIE3bits.BCL1IE = 0;
+  
+  I2C1_ASYNC_Queue[I2C1_ASYNC_Active]->status = I2C1_Record_Status(I2C1_ASYNC_Result);
+  I2C1_ASYNC_Active = (I2C1_ASYNC_Active + 1) & _I2C1_ASYNC_QUEUE_MASK;
+  
+  if (I2C1_ASYNC_Active != I2C1_ASYNC_Head) {
+      I2C1_ASYNC_Start();
+  }
+  else {
+      I2C1_ASYNC_Running = false;
+  }
+}
+
+
+/*** End of File **************************************************************/
@@ -0,0 +1,101 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Asynchronous Transaction Engine
+* Filename              :   i2c1_async.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.1.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC16F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  Per transaction timeouts, results counted in the I2C1 statistics
+*  
+*****************************************************************************/
+
+
+#ifndef _CORE16F_I2C1_ASYNC_H
+#define _CORE16F_I2C1_ASYNC_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core16F.h"
+
+/******************************************************************************
+****** Configuration
+*******************************************************************************/
+#define _I2C1_ASYNC_QUEUE_SIZE 4    //Power of 2 - holds SIZE - 1 transactions
+#define _I2C1_ASYNC_QUEUE_MASK (_I2C1_ASYNC_QUEUE_SIZE - 1)
+#define _I2C1_ASYNC_SERVICE_INTERVAL_MS 1   //Event loop poll rate for completions
+#define _I2C1_ASYNC_DEFAULT_TIMEOUT_US 20000  //Whole transaction, used when timeout_us is 0
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef struct I2C1_Transaction_s I2C1_Transaction_t;
+
+typedef void (*I2C1_Callback_t)(I2C1_Transaction_t *transaction);
+
+/*Owned by the caller and must stay in scope until the callback has run.
+ *Write phase runs first, the read phase follows after a repeated start.
+ *Either length may be 0, both 0 is an address probe.*/
+struct I2C1_Transaction_s {
+  uint8_t address;                      //7-bit address
+  uint8_t *write_data;
+  uint8_t write_length;
+  uint8_t *read_data;
+  uint8_t read_length;
+  I2C1_Callback_t callback;             //Run from I2C1_ASYNC_Service(), NULL for none
+  uint16_t timeout_us;                  //Whole transaction, 0 for the default - checked by Service
+  volatile I2C1_Status_Enum_t status;   //I2C_Busy until the transaction completes
+};
+
+/******************************************************************************
+***** I2C1 Async Interface
+*******************************************************************************/
+typedef struct {
+  void (*Initialize)(void);
+  I2C1_Status_Enum_t (*Submit)(I2C1_Transaction_t *transaction);
+  void (*Service)(void);
+  bool (*IsIdle)(void);
+}I2C1_Async_Interface_t;
+
+extern const I2C1_Async_Interface_t I2C1_ASYNC;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void I2C1_ASYNC_Init(void);
+I2C1_Status_Enum_t I2C1_ASYNC_Submit(I2C1_Transaction_t *transaction);
+void I2C1_ASYNC_Service(void);
+bool I2C1_ASYNC_IsIdle(void);
+void I2C1_ASYNC_ISR(void);
+
+
+#endif /*_CORE16F_I2C1_ASYNC_H*/
+
+/*** End of File **************************************************************/
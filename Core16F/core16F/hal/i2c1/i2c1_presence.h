@@ -0,0 +1,81 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Device Presence Cache
+* Filename              :   i2c1_presence.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC16F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+#ifndef _CORE16F_I2C1_PRESENCE_H
+#define _CORE16F_I2C1_PRESENCE_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core16F.h"
+
+/******************************************************************************
+****** Configuration
+*******************************************************************************/
+#define _I2C1_PRESENCE_REPROBE_MS 5000   //Cached answers older than this are probed again, 0 keeps them until Invalidate
+#define _I2C1_PRESENCE_FIRST_ADDRESS 0x08   //0x00-0x07 and 0x78-0x7F are reserved
+#define _I2C1_PRESENCE_LAST_ADDRESS 0x77
+
+/******************************************************************************
+***** I2C1 Presence Interface
+*******************************************************************************/
+typedef struct {
+  uint8_t (*Scan)(uint8_t *found, uint8_t max_found);
+  bool (*IsPresent)(uint8_t i2c_address);
+  bool (*IsMissing)(uint8_t i2c_address);
+  bool (*Probe)(uint8_t i2c_address);
+  void (*Invalidate)(uint8_t i2c_address);
+  void (*InvalidateAll)(void);
+}I2C1_Presence_Interface_t;
+
+extern const I2C1_Presence_Interface_t I2C1_PRESENCE;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t I2C1_PRESENCE_Scan(uint8_t *found, uint8_t max_found);
+bool I2C1_PRESENCE_IsPresent(uint8_t i2c_address);
+bool I2C1_PRESENCE_IsMissing(uint8_t i2c_address);
+bool I2C1_PRESENCE_Probe(uint8_t i2c_address);
+void I2C1_PRESENCE_Invalidate(uint8_t i2c_address);
+void I2C1_PRESENCE_InvalidateAll(void);
+
+
+#endif /*_CORE16F_I2C1_PRESENCE_H*/
+
+/*** End of File **************************************************************/
@@ -0,0 +1,214 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Target (Slave) Functions
+* Filename              :   i2c1_target.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC16F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "i2c1_target.h"
+
+/******************************************************************************
+* I2C1 Target Interface
+*******************************************************************************/
+const I2C1_Target_Interface_t I2C1_TARGET = {
+  .Initialize = &I2C1_TARGET_Init,
+  .IsBusy = &I2C1_TARGET_IsBusy,
+};
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+const I2C1_Target_Map_t *I2C1_TARGET_Map;
+volatile uint8_t I2C1_TARGET_Pointer;       //Register pointer, auto-increments
+volatile uint8_t I2C1_TARGET_Write_Start;   //First register of the current write
+volatile uint8_t I2C1_TARGET_Write_Count;   //Registers stored by the current write
+volatile bool I2C1_TARGET_Pointer_Next;     //Next byte received sets the pointer
+volatile bool I2C1_TARGET_Reading;          //Direction latched at the address match - R_nW only lasts until the next Start, Stop or NACK
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void I2C1_TARGET_End_Write(void);
+uint8_t I2C1_TARGET_Next_Byte(void);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : I2C1_TARGET_Init()
+* Description: Sets up the MSSP as a 7-bit I2C target answering at i2c_address
+* and serving the register map from the main ISR. SEN holds the clock after
+* each byte until the ISR has stored or loaded it.
+*
+* Parameters:
+*   - i2c_address (uint8_t): 7-bit address.
+*   - map (const I2C1_Target_Map_t*): Register map, must stay valid.
+*
+* Example:
+*   uint8_t sensor_regs[8];
+*   const I2C1_Target_Map_t sensor_map = {sensor_regs, sensor_regs, 8, NULL, &Regs_Written};
+*   I2C1_TARGET.Initialize(0x42, &sensor_map);
+*******************************************************************************/
+void I2C1_TARGET_Init(uint8_t i2c_address, const I2C1_Target_Map_t *map)
+{
+  I2C1_TARGET_Map = map;
+  I2C1_TARGET_Pointer = 0;
+  I2C1_TARGET_Write_Count = 0;
+  I2C1_TARGET_Pointer_Next = false;
+  I2C1_TARGET_Reading = false;
+  
+  I2C1_Map_Pins();
+  
+  SSP1STAT = _I2C1_SSP1STAT; /* CKE disabled; SMP for the bus speed;  */
+  SSP1CON1 = 0x0; /* SSPEN disabled; CKP held; SSPOV no_overflow; WCOL no_collision;  */
+  SSP1CON2 = 0x0; /* GCEN disabled; */
+  SSP1CON2bits.SEN = 1; /* Clock stretching on receive and transmit */
+  SSP1CON3 = 0x0; /* DHEN disabled; AHEN disabled; SBCDE disabled; BOEN disabled; SCIE disabled; */
+  SSP1CON3bits.PCIE = 1; /* SSP1IF on Stop - reports writes */
+  SSP1CON3bits.SDAHT = _I2C1_SDA_HOLD;
+  SSP1CON1bits.SSPM = 0b0110; /* I2C target, 7-bit address */
+  SSP1ADD = (uint8_t)(i2c_address << 1);
+  SSP1MSK = 0xFE; /* Compare all 7 address bits */
+  
+  PIR3bits.SSP1IF = 0;
+  PIE3bits.SSP1IE = 1;
+  SSP1CON1bits.SSPEN = 1;
+  
+  ISR_Peripheral_Interrupt(ENABLED);
+  ISR_Global_Interrupt(ENABLED);
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_IsBusy()
+* Description: true from a Start until the following Stop.
+*
+*******************************************************************************/
+bool I2C1_TARGET_IsBusy(void)
+{
+  return (SSP1STATbits.S == 1);
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_End_Write()
+* Description: Stop or repeated Start - reports the registers the host wrote.
+*
+*******************************************************************************/
+void I2C1_TARGET_End_Write(void)
+{
+  if (I2C1_TARGET_Write_Count > 0) {
+      if (I2C1_TARGET_Map->on_write != NULL) {
+          I2C1_TARGET_Map->on_write(I2C1_TARGET_Write_Start, I2C1_TARGET_Write_Count);
+      }
+      I2C1_TARGET_Write_Count = 0;
+  }
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_Next_Byte()
+* Description: Next register for the host, 0xFF past the end of the map.
+*
+*******************************************************************************/
+uint8_t I2C1_TARGET_Next_Byte(void)
+{
+  if (I2C1_TARGET_Pointer < I2C1_TARGET_Map->size) {
+      return I2C1_TARGET_Map->read_map[I2C1_TARGET_Pointer++];
+  }
+  return 0xFF;
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_ISR()
+* Description: MSSP target state machine, called from the main ISR. SSP1IF is
+* set for the address, every data byte and the Stop. The clock is released
+* (CKP) once the byte has been handled.
+*
+* The direction is latched at the address match - R_nW is cleared by the
+* host's NACK of the last byte read, which would otherwise look like a write.
+* Only a write sets the register pointer from its first byte.
+*******************************************************************************/
+void I2C1_TARGET_ISR(void)
+{
+  uint8_t data;
+  
+  if (!PIR3bits.SSP1IF){return;}
+  PIR3bits.SSP1IF = 0;
+  
+  if (SSP1STATbits.P) {
+      I2C1_TARGET_End_Write();
+      I2C1_TARGET_Pointer_Next = false;
+      I2C1_TARGET_Reading = false;
+      return;
+  }
+  
+  if (!SSP1STATbits.D_nA) {
+      /*Address matched - a repeated Start ends any write in progress*/
+      data = SSP1BUF;
+      I2C1_TARGET_End_Write();
+      I2C1_TARGET_Reading = SSP1STATbits.R_nW;
+      I2C1_TARGET_Pointer_Next = !I2C1_TARGET_Reading;
+      
+      if (I2C1_TARGET_Reading) {
+          if (I2C1_TARGET_Map->on_read != NULL){I2C1_TARGET_Map->on_read(I2C1_TARGET_Pointer);}
+          SSP1BUF = I2C1_TARGET_Next_Byte();
+      }
+  }
+  else if (I2C1_TARGET_Reading) {
+      /*Host NACKs the last byte it wants - the read is over, nothing more to load*/
+      if (SSP1CON2bits.ACKSTAT){I2C1_TARGET_Reading = false;}
+      else {SSP1BUF = I2C1_TARGET_Next_Byte();}
+  }
+  else if (SSP1STATbits.BF) {
+      data = SSP1BUF;
+      if (I2C1_TARGET_Pointer_Next) {
+          I2C1_TARGET_Pointer_Next = false;
+          I2C1_TARGET_Pointer = data;
+          I2C1_TARGET_Write_Start = data;
+      }
+      else if ((I2C1_TARGET_Map->write_map != NULL) && (I2C1_TARGET_Pointer < I2C1_TARGET_Map->size)) {
+          I2C1_TARGET_Map->write_map[I2C1_TARGET_Pointer++] = data;
+          I2C1_TARGET_Write_Count++;
+      }
+  }
+  
+  SSP1CON1bits.SSPOV = 0;
+  SSP1CON1bits.WCOL = 0;
+  SSP1CON1bits.CKP = 1;
+}
+
+
+/*** End of File **************************************************************/
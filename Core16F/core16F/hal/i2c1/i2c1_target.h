@@ -0,0 +1,90 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Target (Slave) Functions
+* Filename              :   i2c1_target.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC16F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+#ifndef _CORE16F_I2C1_TARGET_H
+#define _CORE16F_I2C1_TARGET_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core16F.h"
+
+#ifdef _CORE16F_HAL_I2C1_ASYNC_ENABLE
+    #error "I2C1 is either a host (async engine) or a target - not both"
+#endif
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+/*Both run from the I2C1 interrupt - keep them short, the bus is waiting*/
+typedef void (*I2C1_Target_Read_Callback_t)(uint8_t first_register);                  //Host is about to read - refresh a snapshot
+typedef void (*I2C1_Target_Write_Callback_t)(uint8_t first_register, uint8_t count);  //Host wrote count registers, called at the Stop
+
+/*Register map seen by the host. The first byte of a write sets the register
+ *pointer, following bytes are stored from there. Reads start at the pointer.
+ *The pointer auto-increments - reads past the end return 0xFF, writes past
+ *the end are dropped.*/
+typedef struct {
+  const uint8_t *read_map;              //RAM or const
+  uint8_t *write_map;                   //NULL for a read only map, usually the same array as read_map
+  uint8_t size;
+  I2C1_Target_Read_Callback_t on_read;  //NULL for none
+  I2C1_Target_Write_Callback_t on_write;//NULL for none
+}I2C1_Target_Map_t;
+
+/******************************************************************************
+***** I2C1 Target Interface
+*******************************************************************************/
+typedef struct {
+  void (*Initialize)(uint8_t i2c_address, const I2C1_Target_Map_t *map);
+  bool (*IsBusy)(void);
+}I2C1_Target_Interface_t;
+
+extern const I2C1_Target_Interface_t I2C1_TARGET;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void I2C1_TARGET_Init(uint8_t i2c_address, const I2C1_Target_Map_t *map);
+bool I2C1_TARGET_IsBusy(void);
+void I2C1_TARGET_ISR(void);
+
+
+#endif /*_CORE16F_I2C1_TARGET_H*/
+
+/*** End of File **************************************************************/
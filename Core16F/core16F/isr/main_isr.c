@@ -33,6 +33,8 @@
 *
 *   Date        Version     Author          Description 
 *   2024/04/25  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  I2C1 async engine dispatch
+*   2026/10/18  1.2.0       Jamie Starling  I2C1 target dispatch
 *  
 *****************************************************************************/
 
@@ -56,6 +58,13 @@ void __interrupt () core16F_isr_routine (void) {
 #ifdef _CORE16F_SYSTEM_TIMER_ENABLE
     ISR_CORE16F_SYSTEM_TIMER_ISR();  // Handle Core16F system timer interrupt
 #endif    
+
+#ifdef _CORE16F_HAL_I2C1_ASYNC_ENABLE
+    if (PIE3bits.SSP1IE){I2C1_ASYNC_ISR();}  // I2C1 transaction queue
+#endif
+#ifdef _CORE16F_HAL_I2C1_TARGET_ENABLE
+    if (PIE3bits.SSP1IE){I2C1_TARGET_ISR();}  // I2C1 target register map
+#endif
 }
 
 
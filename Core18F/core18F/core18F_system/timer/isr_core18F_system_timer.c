@@ -34,6 +34,7 @@
 *   Date        Version     Author          Description 
 *   2024/04/25  1.0.0   Jamie Starling  Initial Version
 *   2024/10/28  1.0.1   Jamie Starling  Optimized ISR Function
+*   2026/10/18  1.1.0   Jamie Starling  GetMicros - overflow count plus TMR0L
 *
 *****************************************************************************/
 
@@ -46,6 +47,8 @@
 * Constants
 *******************************************************************************/
 #define _CORE18F_SYSTEM_TIMER_MILLIS_INC 1
+#define _CORE18F_SYSTEM_TIMER_TICK_SHIFT 2      //4us per TMR0 count (Fosc/4, prescaled to 250kHz)
+#define _CORE18F_SYSTEM_TIMER_OVERFLOW_SHIFT 10 //256 counts = 1024us per overflow
 
 /******************************************************************************
 * Variables
@@ -120,5 +123,31 @@ uint32_t ISR_CORE18F_SYSTEM_TIMER_GetMillis(void)
     return time;
 }
 
+/******************************************************************************
+* Function : ISR_CORE18F_SYSTEM_TIMER_GetMicros()
+* Description: Returns microseconds since the system timer was initialized, to
+* 4us resolution. Built from the overflow count and the running TMR0 count, so
+* it keeps true microseconds (an overflow is 1024us). Wraps after about 71
+* minutes - compare differences, not absolute values. The caller's GIE is
+* restored on the way out - the I2C1 timeouts call this with interrupts off.
+*
+* Returns:
+*   - (uint32_t): The elapsed time in microseconds.
+*******************************************************************************/
+uint32_t ISR_CORE18F_SYSTEM_TIMER_GetMicros(void)
+{
+    uint32_t overflows;
+    uint8_t ticks;
+    uint8_t gie_state = INTCON0bits.GIE;
+    
+    INTCON0bits.GIE = 0;
+    ticks = TMR0L;
+    overflows = CORE18F_SYSTEM_TIMER_Millis;
+    if (PIR3bits.TMR0IF && (ticks < 0x80)){overflows++;}   //Rolled over before TMR0L was read, ISR not run yet
+    INTCON0bits.GIE = gie_state;
+    
+    return (overflows << _CORE18F_SYSTEM_TIMER_OVERFLOW_SHIFT) + ((uint32_t)ticks << _CORE18F_SYSTEM_TIMER_TICK_SHIFT);
+}
+
 
 /*** End of File **************************************************************/
@@ -58,6 +58,7 @@
 void ISR_CORE18F_SYSTEM_TIMER_Init(void);
 void ISR_CORE18F_SYSTEM_TIMER_ISR(void);
 uint32_t ISR_CORE18F_SYSTEM_TIMER_GetMillis(void);
+uint32_t ISR_CORE18F_SYSTEM_TIMER_GetMicros(void);
 
 #endif /*_CORE18_SYSTEM_TIMER_H*/
 
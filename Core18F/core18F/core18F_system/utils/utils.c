@@ -3,7 +3,7 @@
 * Filename              :   utils.c
 * Author                :   Jamie Starling
 * Origin Date           :   2024/08/15
-* Version               :   1.0.2
+* Version               :   1.1.0
 * Compiler              :   XC8
 * Target                :   Microchip PIC18F series 
 * Copyright             :    2024 Jamie Starling
@@ -33,6 +33,7 @@
 *
 *   Date        Version     Author          Description 
 *   2024/08/15  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  CORE_uintToDigits - decimal digits without division
 *  
 *
 *****************************************************************************/
@@ -238,4 +239,45 @@ void CORE_intToString(int32_t number, char* buffer)
     buffer[i] = '\0';
 }
 
+/******************************************************************************
+* Function : CORE_uintToDigits 
+* Description: Writes the decimal digits of a number as characters, most
+* significant first, no leading zeros and no terminator. Counts subtractions
+* of each power of ten instead of dividing - no 32-bit divide routine, at most
+* 9 subtractions per digit.
+*
+* Parameters:
+* - uint32_t number: The number to convert.
+* - char* digits: Room for 10 characters.
+*
+* Returns:
+* - uint8_t: The number of digits written, 1 for zero.
+*******************************************************************************/
+uint8_t CORE_uintToDigits(uint32_t number, char* digits)
+{
+    static const uint32_t powers_of_ten[] = {1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+                                             10000UL, 1000UL, 100UL, 10UL};
+    uint8_t count = 0;
+    uint8_t place = 0;
+    char digit;
+
+    // Skip the powers above the number - they would be leading zeros
+    while ((place < sizeof(powers_of_ten) / sizeof(powers_of_ten[0])) && (number < powers_of_ten[place])) {
+        place++;
+    }
+
+    for (; place < sizeof(powers_of_ten) / sizeof(powers_of_ten[0]); place++) {
+        digit = '0';
+        while (number >= powers_of_ten[place]) {
+            number -= powers_of_ten[place];
+            digit++;
+        }
+        digits[count++] = digit;
+    }
+
+    // Units are what is left
+    digits[count++] = (char)('0' + number);
+    return count;
+}
+
 /*** End of File **************************************************************/
@@ -3,7 +3,7 @@
 * Filename              :   utils.h
 * Author                :   Jamie Starling
 * Origin Date           :   2024/08/15
-* Version               :   1.0.2
+* Version               :   1.1.0
 * Compiler              :   XC8
 * Target                :   Microchip PIC18F series
 * Copyright             :    2024 Jamie Starling
@@ -33,6 +33,7 @@
 *
 *   Date        Version     Author          Description 
 *   2024/08/15  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  CORE_uintToDigits - decimal digits without division
 *  
 *****************************************************************************/
 
@@ -54,6 +55,7 @@ uint8_t CORE_Set_Bit(uint8_t byte, uint8_t bit_position);
 uint8_t CORE_Clear_Bit(uint8_t byte, uint8_t bit_position);
 void CORE_floatToString(float number, char* buffer, uint8_t decimalPlaces);
 void CORE_intToString(int32_t number, char* buffer);
+uint8_t CORE_uintToDigits(uint32_t number, char* digits);
 
 #endif /*_CORE_SYSTEM_UTILS_H*/
 /*** End of File **************************************************************/
@@ -97,6 +97,9 @@ typedef enum
     MAX_IOPINS
 }GPIO_Ports_t;
 
+/*RE3 is input only - MCLR when enabled*/
+#define _CORE18F_GPIO_INPUT_ONLY_PIN PORTE_3
+
 /******************************************************************************
 * GPIO Register Lookup
 *******************************************************************************/
@@ -262,6 +265,40 @@ typedef enum
     PPSOUT_CANTX            = 0x46U
 }PPSOutputPeripheralEnum_t;
 
+/******************************************************************************
+***** UART Lookup Tables
+*******************************************************************************/
+#ifdef _CORE18F_HAL_UART_ENABLE
+typedef struct {
+    volatile unsigned char *rxb_reg;        // Pointer to the UxRXB receive buffer
+    volatile unsigned char *txb_reg;        // Pointer to the UxTXB transmit buffer
+    volatile unsigned char *con0_reg;       // Pointer to UxCON0 - BRGS, ABDEN, TXEN, RXEN, MODE
+    volatile unsigned char *con1_reg;       // Pointer to UxCON1 - ON
+    volatile unsigned char *con2_reg;       // Pointer to UxCON2 - Polarity, stop bits, flow control
+    volatile unsigned char *brgl_reg;       // Pointer to UxBRGL
+    volatile unsigned char *brgh_reg;       // Pointer to UxBRGH
+    volatile unsigned char *fifo_reg;       // Pointer to UxFIFO - Buffer status
+    volatile unsigned char *uir_reg;        // Pointer to UxUIR - Auto-baud flags
+    volatile unsigned char *errir_reg;      // Pointer to UxERRIR - Error flags
+    volatile unsigned char *rx_pps_reg;     // Pointer to the UxRXPPS input select register
+    volatile unsigned char *cts_pps_reg;    // Pointer to the UxCTSPPS input select register
+    volatile unsigned char *pie_reg;        // Pointer to the PIE register holding UxRXIE and UxTXIE
+    unsigned char rxie_mask;                // UxRXIE bit in pie_reg
+    unsigned char txie_mask;                // UxTXIE bit in pie_reg
+    PPSOutputPeripheralEnum_t tx_pps;       // PPS output code for UxTX
+    PPSOutputPeripheralEnum_t txde_pps;     // PPS output code for UxTXDE
+} UART_RegisterSet_t;
+
+/*Indexed by UART_Instance_t*/
+const UART_RegisterSet_t UART_Register_LU[] = {
+    {&U1RXB, &U1TXB, &U1CON0, &U1CON1, &U1CON2, &U1BRGL, &U1BRGH, &U1FIFO, &U1UIR, &U1ERRIR, &U1RXPPS, &U1CTSPPS, &PIE4, _PIE4_U1RXIE_MASK, _PIE4_U1TXIE_MASK, PPSOUT_UART1_TX, PPSOUT_UART1_TXDE},  // UART1
+    {&U2RXB, &U2TXB, &U2CON0, &U2CON1, &U2CON2, &U2BRGL, &U2BRGH, &U2FIFO, &U2UIR, &U2ERRIR, &U2RXPPS, &U2CTSPPS, &PIE8, _PIE8_U2RXIE_MASK, _PIE8_U2TXIE_MASK, PPSOUT_UART2_TX, PPSOUT_UART2_TXDE},  // UART2
+    {&U3RXB, &U3TXB, &U3CON0, &U3CON1, &U3CON2, &U3BRGL, &U3BRGH, &U3FIFO, &U3UIR, &U3ERRIR, &U3RXPPS, &U3CTSPPS, &PIE9, _PIE9_U3RXIE_MASK, _PIE9_U3TXIE_MASK, PPSOUT_UART3_TX, PPSOUT_UART3_TXDE},  // UART3
+    {&U4RXB, &U4TXB, &U4CON0, &U4CON1, &U4CON2, &U4BRGL, &U4BRGH, &U4FIFO, &U4UIR, &U4ERRIR, &U4RXPPS, &U4CTSPPS, &PIE12, _PIE12_U4RXIE_MASK, _PIE12_U4TXIE_MASK, PPSOUT_UART4_TX, PPSOUT_UART4_TXDE},  // UART4
+    {&U5RXB, &U5TXB, &U5CON0, &U5CON1, &U5CON2, &U5BRGL, &U5BRGH, &U5FIFO, &U5UIR, &U5ERRIR, &U5RXPPS, &U5CTSPPS, &PIE13, _PIE13_U5RXIE_MASK, _PIE13_U5TXIE_MASK, PPSOUT_UART5_TX, PPSOUT_UART5_TXDE},  // UART5
+};
+#endif //UART LU
+
 
 
 /******************************************************************************
@@ -329,6 +366,38 @@ typedef enum
 }TMR0_PreScaler_SelectEnum_t;
 
 
+/******************************************************************************
+****** Constants: Timer1
+*******************************************************************************/
+
+/******************************************************************************
+* Timer1 Pre-Scaler Select Enum * This enum selects the Pre-Scaler value for Timer1 on the PIC18F2xQ84 devices.
+*******************************************************************************/
+typedef enum
+{
+  TMR1_PRESCALER_1_8 = 0b11,
+  TMR1_PRESCALER_1_4 = 0b10,
+  TMR1_PRESCALER_1_2 = 0b01,
+  TMR1_PRESCALER_1_1 = 0b00
+}TMR1_PreScaler_SelectEnum_t;
+
+/******************************************************************************
+* Timer1 Clock Source Select Enum * This enum selects the clock source value for Timer1 on the PIC18F2xQ84 devices.
+*******************************************************************************/
+typedef enum
+{
+  TMR1_EXTOSC = 0b01000,
+  TMR1_SOSC = 0b00111,
+  TMR1_MFINTOSC_32KHZ = 0b00110,
+  TMR1_MFINTOSC_500KHZ = 0b00101,
+  TMR1_LFINTOSC = 0b00100,
+  TMR1_HFINTOSC = 0b00011,
+  TMR1_FOSC = 0b00010,
+  TMR1_FOSC_D4 = 0b00001,
+  TMR1_T1CKIPPS = 0b00000
+}TMR1_Clock_Source_SelectEnum_t;
+
+
 /******************************************************************************
 ****** Constants: Timer2
 *******************************************************************************/
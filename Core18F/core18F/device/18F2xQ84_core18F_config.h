@@ -93,6 +93,25 @@
 #define _CORE18F_HAL_SERIAL1_ENABLE
 //#define _CORE18F_HAL_SERIAL1_ISR_ENABLE
 
+/******************************************************************************
+* Enable Core MCU - Modbus RTU Slave (drivers/modbus_rtu)
+* Runs on SERIAL1 - needs _CORE18F_HAL_SERIAL1_ISR_ENABLE. Uses TMR1 for
+* the t1.5/t3.5 frame timing, so TMR1 is not available to the application.
+*******************************************************************************/
+//#define _CORE18F_MODBUS_RTU_ENABLE
+
+/******************************************************************************
+* Enable Core MCU - Multi-Instance UART Functions
+* Interrupt driven, buffered driver shared by UART1 to UART5. Buffers are only
+* allocated for the ports enabled here. UART1 cannot be used with SERIAL1.
+*******************************************************************************/
+//#define _CORE18F_HAL_UART_ENABLE
+//#define _CORE18F_HAL_UART1_ENABLE
+//#define _CORE18F_HAL_UART2_ENABLE
+//#define _CORE18F_HAL_UART3_ENABLE
+//#define _CORE18F_HAL_UART4_ENABLE
+//#define _CORE18F_HAL_UART5_ENABLE
+
 
 /******************************************************************************
 * Enable Core MCU - PWM Functions
@@ -112,6 +131,16 @@
 *******************************************************************************/
 #define _CORE18F_HAL_I2C_ENABLE
 
+/*Bus scan and device presence cache (I2C1_PRESENCE) - 36 bytes of RAM*/
+#define _CORE18F_HAL_I2C1_PRESENCE_ENABLE
+
+/*Interrupt driven transaction queue - takes the I2C1 interrupt vectors*/
+//#define _CORE18F_HAL_I2C1_ASYNC_ENABLE
+//#define _CORE18F_I2C1_DMA_ENABLE     //Async transfers through DMA1 (TX) and DMA2 (RX)
+
+/*Register map target instead of host - takes the I2C1 interrupt vectors*/
+//#define _CORE18F_HAL_I2C1_TARGET_ENABLE
+
 /******************************************************************************
 * Enable Core8 - One Wire Functions
 *******************************************************************************/
@@ -154,6 +183,8 @@ const GPIO_Config_t GPIO_Config[]=
 
 #define _CORE18F_SERIAL1_INPUT_PIN PORTC_7
 #define _CORE18F_SERIAL1_OUTPUT_PIN PORTC_6
+//#define _CORE18F_SERIAL1_TXDE_PIN PORTC_5  //RS-485 DE - Direction switched by the UART in hardware
+//#define _CORE18F_SERIAL1_CTS_PIN PORTC_2   //Spare pin driven low - U1CTS, required with TXDE
 //#define _CORE18F_SERIAL1_PPSOUT_REGISTER 
 
 typedef enum
@@ -215,6 +246,7 @@ const PWM_Config_t PWM_Config[]=
 *******************************************************************************/
 #define I2C1_CLOCK_PIN PORTC_3
 #define I2C1_DATA_PIN PORTC_4
+#define _I2C1_BUS_SPEED_HZ 100000UL  //100000 Standard, 400000 Fast-mode, 1000000 Fast-mode Plus
 
 
 /******************************************************************************
@@ -0,0 +1,335 @@
+/****************************************************************************
+* Title                 :   Serial Command Line Interface
+* Filename              :   cli.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "cli.h"
+
+/******************************************************************************
+* Interface
+*******************************************************************************/
+const CLI_Interface_t CLI = {
+  .Initialize = &CLI_Init,
+  .Process = &CLI_Process,
+  .ReceiveByte = &CLI_ReceiveByte,
+  .ParseInt = &CLI_ParseInt,
+};
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+/*Indexed by CLI_Status_Enum_t*/
+const char * const CLI_Status_Text[] = {
+    "",
+    "Unknown command",
+    "Bad argument",
+    "Too many arguments",
+    "Line too long"
+};
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+char CLI_Line[_CLI_LINE_BUFFER_SIZE + 1];   //+1 for the terminator
+uint8_t CLI_Line_Length = 0;
+bool CLI_Line_Overflow = false;
+volatile bool CLI_Line_Ready = false;
+
+const CLI_Command_t *CLI_Command_Table;
+uint8_t CLI_Command_Count = 0;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+CLI_Status_Enum_t CLI_Execute(void);
+uint8_t CLI_Tokenize(char *line, char *argv[]);
+bool CLI_Match(const char *name, const char *token);
+void CLI_WriteString(const char *text);
+void CLI_Echo(uint8_t data);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : CLI_Init()
+* Description: Sets the command table and prints the first prompt.
+* SERIAL1 must already be initialized.
+*
+* Parameters:
+*   - command_table (const CLI_Command_t*): Application command table.
+*   - command_count (uint8_t): Number of entries in the table.
+*
+* Example:
+*   const CLI_Command_t Commands[] = {
+*       {"led", &Command_LED},
+*       {"read", &Command_Read},
+*   };
+*   CLI.Initialize(Commands, sizeof(Commands) / sizeof(Commands[0]));
+*******************************************************************************/
+void CLI_Init(const CLI_Command_t *command_table, uint8_t command_count)
+{
+  CLI_Command_Table = command_table;
+  CLI_Command_Count = command_count;
+  CLI_Line_Length = 0;
+  CLI_Line_Overflow = false;
+  CLI_Line_Ready = false;
+  CLI_WriteString(_CLI_PROMPT);
+}
+
+/******************************************************************************
+* Function : CLI_Process()
+* Description: Non-blocking - call from the main loop. Moves at most
+* _CLI_MAX_BYTES_PER_PROCESS received bytes into the line buffer and runs the
+* command once a full line has arrived. The handler runs in the callers context.
+*******************************************************************************/
+void CLI_Process(void)
+{
+  CLI_Status_Enum_t status;
+  uint8_t count = 0;
+  
+  while (!CLI_Line_Ready && (count < _CLI_MAX_BYTES_PER_PROCESS) && SERIAL1.IsDataAvailable()) {
+      CLI_ReceiveByte(SERIAL1.ReadByte());
+      count++;
+  }
+  
+  if (SERIAL1.IsError() != OK){SERIAL1.ClearErrors();}
+  
+  if (!CLI_Line_Ready){return;}
+  
+  status = CLI_Execute();
+  if (status != CLI_OK) {
+      CLI_WriteString(CLI_Status_Text[status]);
+      CLI_WriteString("\r\n");
+  }
+  
+  CLI_Line_Length = 0;
+  CLI_Line_Overflow = false;
+  CLI_Line_Ready = false;
+  CLI_WriteString(_CLI_PROMPT);
+}
+
+/******************************************************************************
+* Function : CLI_ReceiveByte()
+* Description: Adds one received byte to the line buffer. CLI_Process() calls
+* this when polling, it may also be fed bytes from another source. Main loop
+* only - never from an ISR, it echoes with blocking SERIAL1 writes and shares
+* the line buffer with CLI_Process() unguarded.
+* Bytes arriving while a complete line is waiting to run are dropped.
+*
+* Parameters:
+*   - data (uint8_t): Byte received from the terminal.
+*******************************************************************************/
+void CLI_ReceiveByte(uint8_t data)
+{
+  if (CLI_Line_Ready){return;}
+  
+  if ((data == '\r') || (data == '\n')) {
+      if ((CLI_Line_Length == 0) && !CLI_Line_Overflow){return;}  //Blank line or the LF of a CRLF
+      CLI_Line[CLI_Line_Length] = '\0';
+      CLI_Line_Ready = true;
+      CLI_Echo('\r');
+      CLI_Echo('\n');
+      return;
+  }
+  
+  if ((data == '\b') || (data == 0x7F)) {  //Backspace or DEL
+      if (CLI_Line_Length > 0) {
+          CLI_Line_Length--;
+          CLI_Echo('\b');
+          CLI_Echo(' ');
+          CLI_Echo('\b');
+      }
+      return;
+  }
+  
+  if (CLI_Line_Length < _CLI_LINE_BUFFER_SIZE) {
+      CLI_Line[CLI_Line_Length++] = (char)data;
+      CLI_Echo(data);
+  }
+  else {CLI_Line_Overflow = true;}
+}
+
+/******************************************************************************
+* Function : CLI_ParseInt()
+* Description: Converts a decimal (optionally signed) or 0x prefixed hex
+* argument to an integer. The whole string must be a number.
+*
+* Parameters:
+*   - text (const char*): Argument string.
+*   - value (int32_t*): Receives the result, untouched on failure.
+*
+* Returns:
+*   - bool: true on success, false if empty, not a number or out of range.
+*     Hex accepts the full 32 bits, 0xFFFFFFFF returns -1.
+*******************************************************************************/
+bool CLI_ParseInt(const char *text, int32_t *value)
+{
+  uint32_t result = 0;
+  uint32_t limit = 0x7FFFFFFF;
+  uint8_t base = 10;
+  uint8_t digit;
+  bool negative = false;
+  
+  if (*text == '-'){negative = true; limit = 0x80000000; text++;}
+  else if (*text == '+'){text++;}
+  
+  if ((text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X')) && !negative) {
+      base = 16;
+      limit = 0xFFFFFFFF;
+      text += 2;
+  }
+  
+  if (*text == '\0'){return false;}
+  
+  while (*text) {
+      if ((*text >= '0') && (*text <= '9')){digit = (uint8_t)(*text - '0');}
+      else if ((base == 16) && (*text >= 'a') && (*text <= 'f')){digit = (uint8_t)(*text - 'a' + 10);}
+      else if ((base == 16) && (*text >= 'A') && (*text <= 'F')){digit = (uint8_t)(*text - 'A' + 10);}
+      else {return false;}
+      
+      if (result > ((limit - digit) / base)){return false;}
+      result = (result * base) + digit;
+      text++;
+  }
+  
+  *value = negative ? (int32_t)(0 - result) : (int32_t)result;
+  return true;
+}
+
+/******************************************************************************
+* Function : CLI_Execute()
+* Description: Splits the line buffer into arguments and calls the matching handler.
+*
+* Returns:
+*   - CLI_Status_Enum_t: Handler result, or why no handler was called.
+*******************************************************************************/
+CLI_Status_Enum_t CLI_Execute(void)
+{
+  char *argv[_CLI_MAX_ARGS];
+  uint8_t argc;
+  
+  if (CLI_Line_Overflow){return CLI_LINE_OVERFLOW;}
+  
+  argc = CLI_Tokenize(CLI_Line, argv);
+  if (argc == 0){return CLI_OK;}
+  if (argc > _CLI_MAX_ARGS){return CLI_TOO_MANY_ARGS;}
+  
+  for (uint8_t i = 0; i < CLI_Command_Count; i++) {
+      if (CLI_Match(CLI_Command_Table[i].name, argv[0])) {
+          return CLI_Command_Table[i].handler(argc, argv);
+      }
+  }
+  
+  return CLI_UNKNOWN_COMMAND;
+}
+
+/******************************************************************************
+* Function : CLI_Tokenize()
+* Description: Splits the line in place - separators are overwritten with
+* terminators and argv points into the line buffer, nothing is copied.
+*
+* Parameters:
+*   - line (char*): Terminated line to split.
+*   - argv (char*[]): Receives up to _CLI_MAX_ARGS pointers.
+*
+* Returns:
+*   - uint8_t: Argument count, _CLI_MAX_ARGS + 1 if there were too many.
+*******************************************************************************/
+uint8_t CLI_Tokenize(char *line, char *argv[])
+{
+  uint8_t argc = 0;
+  
+  for (;;) {
+      while ((*line == ' ') || (*line == '\t')){*line++ = '\0';}
+      if (*line == '\0'){break;}
+      
+      if (argc == _CLI_MAX_ARGS){return _CLI_MAX_ARGS + 1;}
+      argv[argc++] = line;
+      
+      while ((*line != '\0') && (*line != ' ') && (*line != '\t')){line++;}
+  }
+  
+  return argc;
+}
+
+/******************************************************************************
+* Function : CLI_Match()
+* Description: Case insensitive compare of a command name and a token.
+*
+* Returns:
+*   - bool: true if they are the same.
+*******************************************************************************/
+bool CLI_Match(const char *name, const char *token)
+{
+  char a, b;
+  
+  do {
+      a = *name++;
+      b = *token++;
+      if ((a >= 'A') && (a <= 'Z')){a += 'a' - 'A';}
+      if ((b >= 'A') && (b <= 'Z')){b += 'a' - 'A';}
+      if (a != b){return false;}
+  } while (a != '\0');
+  
+  return true;
+}
+
+/******************************************************************************
+* Function : CLI_WriteString()
+* Description: Writes a const string - SERIAL1.WriteString takes a RAM pointer.
+*******************************************************************************/
+void CLI_WriteString(const char *text)
+{
+  while (*text){SERIAL1.WriteByte((uint8_t)*text++);}
+}
+
+/******************************************************************************
+* Function : CLI_Echo()
+* Description: Echoes a byte back to the terminal when _CLI_ECHO_ENABLE is set.
+*******************************************************************************/
+void CLI_Echo(uint8_t data)
+{
+#ifdef _CLI_ECHO_ENABLE
+  SERIAL1.WriteByte(data);
+#else
+  (void)data;
+#endif
+}
+
+/*** End of File **************************************************************/
@@ -0,0 +1,180 @@
+/****************************************************************************
+* Title                 :   LCD Parallel Drivers
+* Filename              :   lcd_parallel.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+#ifndef _COREMCU_LCD_PARALLEL_H
+#define _COREMCU_LCD_PARALLEL_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core_version.h"
+
+#ifdef _CORE16_MCU
+    #include "../../core16F.h"
+#endif
+
+#ifdef _CORE18_MCU
+	#include "../../core18F.h"
+#endif
+
+/******************************************************************************
+* HD44780 in 4-bit mode on GPIO - an alternative to the I2C backpack (lcd_i2c)
+* for boards with six pins to spare. RW is tied low.
+*
+* D4-D7 are four pins in a row on one port (D4 on the lowest) and every nibble
+* is one write of that port's LAT register, found through GPIO_Register_LU.
+* Initialize rejects any run that crosses a port or takes in the input only
+* pin, and RS, EN or a backlight pin that cannot drive.
+* A character takes about 55us - the controller's execute time - against
+* about 1ms through a PCF8574 at 100kHz.
+*
+* The other pins of the port may be used for anything that is not written
+* from an interrupt - a nibble write is a read-modify-write of LAT.
+*
+* The calls match the basic LCD calls in lcd_i2c.h (Initialize, BlackLight,
+* Location, Clear, Write_Character, Write). With _LCD_PARALLEL_AS_LCD defined
+* this driver also answers to LCD and the LCD_I2C type and status names, so
+* code written against lcd_i2c builds unchanged with lcd_parallel.h included
+* in place of lcd_i2c.h - only the device declaration moves from an address
+* to pins. The framebuffer, refresh, glyph and field calls are I2C only.
+*******************************************************************************/
+//#define _LCD_PARALLEL_AS_LCD
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+#define _LCD_PARALLEL_RS_CMD 0
+#define _LCD_PARALLEL_RS_DATA 1
+#define _LCD_PARALLEL_CMD_8bit_Mode 0x03           //Nibble - sent three times to sync from any state
+#define _LCD_PARALLEL_CMD_4bit_Mode 0x02           //Nibble
+#define _LCD_PARALLEL_CMD_Function_Set 0b00101000  //4-bit, 2 lines, 5x8
+#define _LCD_PARALLEL_CMD_Display_Set 0b00001110   //Display on, cursor on
+#define _LCD_PARALLEL_CMD_Entry_Mode 0b00000110    //Increment, no shift
+#define _LCD_PARALLEL_CMD_CLEAR 0b00000001
+#define _LCD_PARALLEL_CMD_SET_DDRAM 0b10000000
+#define _LCD_PARALLEL_MAX_ROWS 4
+#define _LCD_PARALLEL_NO_PIN MAX_IOPINS            //Backlight not switched
+#define _LCD_PARALLEL_LU_PINS (sizeof(GPIO_Register_LU) / sizeof(GPIO_Register_LU[0]))  //Pins with a LAT register
+
+#ifdef _CORE16_MCU
+    #define _LCD_PARALLEL_INPUT_ONLY_PIN _CORE16F_GPIO_INPUT_ONLY_PIN
+#endif
+
+#ifdef _CORE18_MCU
+    #define _LCD_PARALLEL_INPUT_ONLY_PIN _CORE18F_GPIO_INPUT_ONLY_PIN
+#endif
+
+#define _LCD_PARALLEL_POWER_UP_DELAY_MS 40
+#define _LCD_PARALLEL_SYNC_DELAY_MS 5              //After the first 8-bit mode nibble
+#define _LCD_PARALLEL_EXECUTE_DELAY_US 53          //Slowest data/command time (190kHz oscillator)
+#define _LCD_PARALLEL_CLEAR_DELAY_MS 2
+#define _LCD_PARALLEL_EN_PULSE_US 1                //450ns minimum EN high
+
+/*Common geometries - pins are GPIO_Ports_t*/
+#define LCD_PARALLEL_1602(d4, rs, en, backlight) {d4, rs, en, backlight, 2, 16, {0x00, 0x40, 0x00, 0x00}, 0}
+#define LCD_PARALLEL_1604(d4, rs, en, backlight) {d4, rs, en, backlight, 4, 16, {0x00, 0x40, 0x10, 0x50}, 0}
+#define LCD_PARALLEL_2002(d4, rs, en, backlight) {d4, rs, en, backlight, 2, 20, {0x00, 0x40, 0x00, 0x00}, 0}
+#define LCD_PARALLEL_2004(d4, rs, en, backlight) {d4, rs, en, backlight, 4, 20, {0x00, 0x40, 0x14, 0x54}, 0}
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+ LCD_PARALLEL_OK,
+ LCD_PARALLEL_GENERIC_ERROR,
+ LCD_PARALLEL_INVALID_PINS
+}LCD_Parallel_Status_Enum_t;
+
+/*One per display, owned by the application. Displays can share D4-D7 and RS
+ *as long as each has its own EN.*/
+typedef struct
+{
+  GPIO_Ports_t d4;                                //D5-D7 are the next three pins of the port
+  GPIO_Ports_t rs;
+  GPIO_Ports_t en;
+  GPIO_Ports_t backlight;                         //_LCD_PARALLEL_NO_PIN if not switched
+  uint8_t rows;
+  uint8_t columns;
+  uint8_t line_offset[_LCD_PARALLEL_MAX_ROWS];    //DDRAM address of the first cell of each row
+  uint8_t data_shift;                             //Set up by Initialize - D4's bit in LAT
+}LCD_Parallel_Device_t;
+
+/******************************************************************************
+***** LCD_PARALLEL Interface
+*******************************************************************************/
+typedef struct {
+  LCD_Parallel_Status_Enum_t (*Initialize)(LCD_Parallel_Device_t *lcd);
+  LCD_Parallel_Status_Enum_t (*BlackLight)(LCD_Parallel_Device_t *lcd, LogicEnum_t set_light);
+  LCD_Parallel_Status_Enum_t (*Location)(LCD_Parallel_Device_t *lcd, uint8_t row, uint8_t column);
+  LCD_Parallel_Status_Enum_t (*Clear)(LCD_Parallel_Device_t *lcd);
+  LCD_Parallel_Status_Enum_t (*Write_Character)(LCD_Parallel_Device_t *lcd, uint8_t character);
+  LCD_Parallel_Status_Enum_t (*Write)(LCD_Parallel_Device_t *lcd, char *StringData);
+}LCD_Parallel_Interface_t;
+
+extern const LCD_Parallel_Interface_t LCD_PARALLEL;
+
+/******************************************************************************
+***** Build-time backend switch - LCD names bound to this driver
+*******************************************************************************/
+#ifdef _LCD_PARALLEL_AS_LCD
+    #ifdef _CORE_LCD_I2C_H
+        #error "_LCD_PARALLEL_AS_LCD binds LCD to lcd_parallel - do not include lcd_i2c.h as well"
+    #endif
+    typedef LCD_Parallel_Device_t LCD_I2C_Device_t;
+    typedef LCD_Parallel_Status_Enum_t LCD_I2C_Status_Enum_t;
+    typedef LCD_Parallel_Interface_t LCD_I2C_Interface_t;
+    #define LCD_I2C_OK LCD_PARALLEL_OK
+    #define LCD_I2C_GENERIC_ERROR LCD_PARALLEL_GENERIC_ERROR
+    #define LCD_I2C_INVALID_ADDRESS LCD_PARALLEL_INVALID_PINS
+    #define LCD LCD_PARALLEL
+#endif
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Init(LCD_Parallel_Device_t *lcd);
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_BackLight(LCD_Parallel_Device_t *lcd, LogicEnum_t set_light);
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Location(LCD_Parallel_Device_t *lcd, uint8_t row, uint8_t column);
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Clear_Display(LCD_Parallel_Device_t *lcd);
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Write_Character(LCD_Parallel_Device_t *lcd, uint8_t character);
+LCD_Parallel_Status_Enum_t LCD_PARALLEL_Write_String(LCD_Parallel_Device_t *lcd, char *StringData);
+
+#endif /*_COREMCU_LCD_PARALLEL_H*/
+
+/*** End of File **************************************************************/
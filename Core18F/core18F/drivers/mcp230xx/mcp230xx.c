@@ -0,0 +1,312 @@
+/****************************************************************************
+* Title                 :   MCP23017 / MCP23008 I2C GPIO Expander Driver
+* Filename              :   mcp230xx.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   PIC MCUs
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "mcp230xx.h"
+
+/******************************************************************************
+* Interface
+*******************************************************************************/
+const MCP230XX_Interface_t MCP230XX = {
+  .Initialize = &MCP230XX_Init,
+  .ModeSet = &MCP230XX_SetDirection,
+  .PinWrite = &MCP230XX_WritePin,
+  .PinToggle = &MCP230XX_TogglePin,
+  .PinRead = &MCP230XX_ReadPin,
+  .Flush = &MCP230XX_Flush,
+  .ReadPorts = &MCP230XX_ReadPorts,
+};
+
+/******************************************************************************
+* Register Addresses - port A, indexed by shadow
+*******************************************************************************/
+const uint8_t MCP23017_Registers[_MCP230XX_SHADOWS] = {_MCP23017_GPPU, _MCP23017_OLAT, _MCP23017_IODIR};
+const uint8_t MCP23008_Registers[_MCP230XX_SHADOWS] = {_MCP23008_GPPU, _MCP23008_OLAT, _MCP23008_IODIR};
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool MCP230XX_Pin_Valid(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin);
+void MCP230XX_Shadow_Set(MCP230XX_Device_t *device, uint8_t shadow, MCP230XX_Pins_t Pin, bool set);
+bool MCP230XX_Present(MCP230XX_Device_t *device);
+void MCP230XX_Failed(MCP230XX_Device_t *device);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : MCP230XX_Init()
+* Description: Initializes I2C1 and puts the expander in its reset state - all
+* pins inputs, no pull-ups, latches low. Written out in full, the chip may
+* have kept an old setup through an MCU reset.
+*
+* Parameters:
+*   - device (MCP230XX_Device_t*): The expander.
+*
+* Returns:
+*   - MCP230XX_Status_Enum_t: MCP230XX_GENERIC_ERROR if the expander does not answer.
+*
+* Example:
+*   MCP230XX_Device_t Expander = MCP23017(_MCP230XX_BASE_ADDRESS);
+*   MCP230XX.Initialize(&Expander);
+*   MCP230XX.ModeSet(&Expander, MCP230XX_GPA0, OUTPUT);
+*   MCP230XX.PinWrite(&Expander, MCP230XX_GPA0, HIGH);
+*   MCP230XX.Flush(&Expander);
+*******************************************************************************/
+MCP230XX_Status_Enum_t MCP230XX_Init(MCP230XX_Device_t *device)
+{
+  if ((device->ports == 0) || (device->ports > _MCP230XX_MAX_PORTS)){return MCP230XX_GENERIC_ERROR;}
+  
+  I2C1_MASTER.Initialize();
+  
+  for (uint8_t port = 0; port < _MCP230XX_MAX_PORTS; port++) {
+    device->shadow[_MCP230XX_GPPU][port] = 0x00;
+    device->shadow[_MCP230XX_OLAT][port] = 0x00;
+    device->shadow[_MCP230XX_IODIR][port] = 0xFF;
+    
+    // Unlike the shadows, so Flush sends everything
+    for (uint8_t shadow = 0; shadow < _MCP230XX_SHADOWS; shadow++){device->chip[shadow][port] = (uint8_t)~device->shadow[shadow][port];}
+    }
+  
+  return MCP230XX_Flush(device);
+}
+
+/******************************************************************************
+* Function : MCP230XX_SetDirection()
+* Description: Sets a pin to OUTPUT, INPUT or INPUT_W_PULLUP (100k) in the
+* shadows - sent by the next Flush. Other modes are ignored.
+*
+* Parameters:
+*   - device (MCP230XX_Device_t*): The expander.
+*   - Pin (MCP230XX_Pins_t): The pin.
+*   - PinDirection (PinDirectionEnum_t): The mode.
+*******************************************************************************/
+void MCP230XX_SetDirection(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin, PinDirectionEnum_t PinDirection)
+{
+  switch (PinDirection)
+  {
+      case OUTPUT:
+          MCP230XX_Shadow_Set(device, _MCP230XX_IODIR, Pin, false);
+          MCP230XX_Shadow_Set(device, _MCP230XX_GPPU, Pin, false);
+          break;
+      case INPUT:
+          MCP230XX_Shadow_Set(device, _MCP230XX_IODIR, Pin, true);
+          MCP230XX_Shadow_Set(device, _MCP230XX_GPPU, Pin, false);
+          break;
+      case INPUT_W_PULLUP:
+          MCP230XX_Shadow_Set(device, _MCP230XX_IODIR, Pin, true);
+          MCP230XX_Shadow_Set(device, _MCP230XX_GPPU, Pin, true);
+          break;
+      default:
+          break;
+  }
+}
+
+/******************************************************************************
+* Function : MCP230XX_WritePin()
+* Description: Sets a pin's output latch in the shadow - sent by the next Flush.
+*
+*******************************************************************************/
+void MCP230XX_WritePin(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin, LogicEnum_t PinLevel)
+{
+  MCP230XX_Shadow_Set(device, _MCP230XX_OLAT, Pin, (PinLevel == HIGH));
+}
+
+/******************************************************************************
+* Function : MCP230XX_TogglePin()
+* Description: Flips a pin's output latch in the shadow - sent by the next Flush.
+*
+*******************************************************************************/
+void MCP230XX_TogglePin(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin)
+{
+  if (!MCP230XX_Pin_Valid(device, Pin)){return;}
+  
+  device->shadow[_MCP230XX_OLAT][Pin >> 3] ^= (uint8_t)(1 << (Pin & 0x07));
+}
+
+/******************************************************************************
+* Function : MCP230XX_ReadPin()
+* Description: Reads a pin's level from the chip - one I2C transaction.
+* Use ReadPorts to read several pins at once.
+*
+* Returns:
+*   - LogicEnum_t: HIGH or LOW, LOW if the expander does not answer.
+*******************************************************************************/
+LogicEnum_t MCP230XX_ReadPin(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin)
+{
+  uint8_t register_address;
+  uint8_t levels;
+  
+  if (!MCP230XX_Pin_Valid(device, Pin)){return LOW;}
+  
+  if (!MCP230XX_Present(device)){return LOW;}
+  
+  register_address = (uint8_t)(((device->ports == 2) ? _MCP23017_GPIO : _MCP23008_GPIO) + (Pin >> 3));
+  if (I2C1_MASTER.ReadData(device->i2c_address, 1, &register_address, 1, &levels) != I2C_OK){MCP230XX_Failed(device); return LOW;}
+  
+  return (levels & (1 << (Pin & 0x07))) ? HIGH : LOW;
+}
+
+/******************************************************************************
+* Function : MCP230XX_Flush()
+* Description: Sends the shadow registers that differ from the chip. Both
+* ports of a register go in one write when both changed - the address
+* increments from A to B. Nothing changed costs no bus traffic.
+*
+* Returns:
+*   - MCP230XX_Status_Enum_t: MCP230XX_GENERIC_ERROR on a failed write, the
+*     unsent registers are tried again by the next Flush.
+*******************************************************************************/
+MCP230XX_Status_Enum_t MCP230XX_Flush(MCP230XX_Device_t *device)
+{
+  const uint8_t *registers = (device->ports == 2) ? MCP23017_Registers : MCP23008_Registers;
+  uint8_t data[1 + _MCP230XX_MAX_PORTS];
+  uint8_t first, last, length;
+  
+  for (uint8_t shadow = 0; shadow < _MCP230XX_SHADOWS; shadow++)
+  {
+      /*Changed ports - first > last if none*/
+      first = device->ports;
+      last = 0;
+      for (uint8_t port = 0; port < device->ports; port++) {
+        if (device->shadow[shadow][port] != device->chip[shadow][port]) {
+          if (first == device->ports){first = port;}
+          last = port;
+          }
+        }
+      if (first > last){continue;}
+      
+      length = 0;
+      data[length++] = (uint8_t)(registers[shadow] + first);
+      for (uint8_t port = first; port <= last; port++){data[length++] = device->shadow[shadow][port];}
+      
+      if (!MCP230XX_Present(device)){return MCP230XX_GENERIC_ERROR;}
+      if (I2C1_MASTER.WriteData(device->i2c_address, length, data) != I2C_OK){MCP230XX_Failed(device); return MCP230XX_GENERIC_ERROR;}
+      
+      for (uint8_t port = first; port <= last; port++){device->chip[shadow][port] = device->shadow[shadow][port];}
+  }
+  return MCP230XX_OK;
+}
+
+/******************************************************************************
+* Function : MCP230XX_ReadPorts()
+* Description: Reads every pin in one I2C transaction.
+*
+* Parameters:
+*   - device (MCP230XX_Device_t*): The expander.
+*   - levels (uint16_t*): Bit n is MCP230XX_Pins_t n - port B is the high byte.
+*
+* Returns:
+*   - MCP230XX_Status_Enum_t
+*
+* Example:
+*   uint16_t levels;
+*   if (MCP230XX.ReadPorts(&Expander, &levels) == MCP230XX_OK && (levels & (1 << MCP230XX_GPB3))) {...}
+*******************************************************************************/
+MCP230XX_Status_Enum_t MCP230XX_ReadPorts(MCP230XX_Device_t *device, uint16_t *levels)
+{
+  uint8_t register_address = (device->ports == 2) ? _MCP23017_GPIO : _MCP23008_GPIO;
+  uint8_t ports[_MCP230XX_MAX_PORTS] = {0, 0};
+  
+  if (!MCP230XX_Present(device)){return MCP230XX_GENERIC_ERROR;}
+  if (I2C1_MASTER.ReadData(device->i2c_address, 1, &register_address, device->ports, ports) != I2C_OK){MCP230XX_Failed(device); return MCP230XX_GENERIC_ERROR;}
+  
+  *levels = CORE.Make16(ports[1], ports[0]);
+  return MCP230XX_OK;
+}
+
+/******************************************************************************
+* Function : MCP230XX_Pin_Valid()
+* Description: true if the pin exists on this part.
+*
+*******************************************************************************/
+bool MCP230XX_Pin_Valid(MCP230XX_Device_t *device, MCP230XX_Pins_t Pin)
+{
+  return (Pin < (device->ports * 8));
+}
+
+/******************************************************************************
+* Function : MCP230XX_Shadow_Set()
+* Description: Sets or clears a pin's bit in one shadow register.
+*
+*******************************************************************************/
+void MCP230XX_Shadow_Set(MCP230XX_Device_t *device, uint8_t shadow, MCP230XX_Pins_t Pin, bool set)
+{
+  uint8_t mask;
+  
+  if (!MCP230XX_Pin_Valid(device, Pin)){return;}
+  
+  mask = (uint8_t)(1 << (Pin & 0x07));
+  if (set){device->shadow[shadow][Pin >> 3] |= mask;}
+  else {device->shadow[shadow][Pin >> 3] &= (uint8_t)~mask;}
+}
+
+/******************************************************************************
+* Function : MCP230XX_Present()
+* Description: Cached presence check ahead of a transfer - always true without
+* the I2C1 presence cache.
+*
+*******************************************************************************/
+bool MCP230XX_Present(MCP230XX_Device_t *device)
+{
+#ifdef _MCP230XX_PRESENCE
+  return I2C1_PRESENCE.IsPresent(device->i2c_address);
+#else
+  return true;
+#endif
+}
+
+/******************************************************************************
+* Function : MCP230XX_Failed()
+* Description: A transfer failed - drops the cache entry so the next transfer
+* probes again.
+*
+*******************************************************************************/
+void MCP230XX_Failed(MCP230XX_Device_t *device)
+{
+#ifdef _MCP230XX_PRESENCE
+  I2C1_PRESENCE.Invalidate(device->i2c_address);
+#endif
+}
+
+
+/*** End of File **************************************************************/
@@ -0,0 +1,606 @@
+/****************************************************************************
+* Title                 :   Modbus RTU Slave
+* Filename              :   modbus_rtu.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "modbus_rtu.h"
+
+/******************************************************************************
+* Interface
+*******************************************************************************/
+const MODBUS_Interface_t MODBUS = {
+  .Initialize = &MODBUS_Init,
+  .Process = &MODBUS_Process,
+  .GetStats = &MODBUS_GetStats,
+  .CRC16 = &MODBUS_CRC16,
+};
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+/*CRC-16/MODBUS (reflected 0xA001) - one lookup per byte*/
+const uint16_t MODBUS_CRC16_Table[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  MODBUS_STATE_STARTUP,       //Waiting for t3.5 of silence before the first frame
+  MODBUS_STATE_IDLE,
+  MODBUS_STATE_RECEIVING,
+  MODBUS_STATE_FRAME_READY,   //t3.5 seen - MODBUS_Process() owns the buffer
+  MODBUS_STATE_TRANSMITTING,
+  MODBUS_STATE_TX_DRAIN       //Last byte in the FIFO, waiting for the stop bit
+}MODBUS_State_t;
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+/*One buffer - the request is parsed and the response built in place*/
+uint8_t MODBUS_Buffer[_MODBUS_ADU_SIZE];
+volatile uint16_t MODBUS_Length = 0;
+volatile uint16_t MODBUS_TX_Index = 0;
+volatile MODBUS_State_t MODBUS_State = MODBUS_STATE_STARTUP;
+volatile bool MODBUS_Frame_Error = false;
+
+uint8_t MODBUS_Address;
+const MODBUS_Map_t *MODBUS_Map;
+uint16_t MODBUS_T35_Preload;    //TMR1 preload that overflows after t3.5
+uint16_t MODBUS_Gap_Limit;      //Ticks between character ends - one character + t1.5
+MODBUS_Stats_t MODBUS_Stats;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint16_t MODBUS_Execute(uint16_t length);
+uint8_t MODBUS_Request_Length(uint8_t function);
+MODBUS_Exception_t MODBUS_Read_Bits(MODBUS_Table_t table, const uint8_t *bits, uint16_t bit_count, uint16_t address, uint16_t count, uint16_t *response_length);
+MODBUS_Exception_t MODBUS_Read_Registers(MODBUS_Table_t table, const uint16_t *registers, uint16_t register_count, uint16_t address, uint16_t count, uint16_t *response_length);
+MODBUS_Exception_t MODBUS_Write_Coils(uint16_t address, uint16_t count, const uint8_t *values);
+MODBUS_Exception_t MODBUS_Write_Registers(uint16_t address, uint16_t count, const uint8_t *values);
+MODBUS_Exception_t MODBUS_Before_Read(MODBUS_Table_t table, uint16_t address, uint16_t count);
+MODBUS_Exception_t MODBUS_After_Write(MODBUS_Table_t table, uint16_t address, uint16_t count);
+void MODBUS_Timer_Restart(void);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : MODBUS_Init()
+* Description: Starts SERIAL1, works out the t1.5/t3.5 silent intervals for
+* the baud rate and sets up TMR1 to time them. Requests are answered from
+* MODBUS_Process() in the main loop.
+*
+* Parameters:
+*   - slave_address (uint8_t): Node address, 1 to 247.
+*   - BaudSelect (SerialBaudEnum_t): Baud rate from the SERIAL1 config table.
+*   - map (const MODBUS_Map_t*): Application coils, inputs and registers.
+*
+* Example:
+*   uint16_t Holding[8];
+*   const MODBUS_Map_t Map = {.holding_registers = Holding, .holding_register_count = 8};
+*   MODBUS.Initialize(0x11, BAUD_19200, &Map);
+*******************************************************************************/
+void MODBUS_Init(uint8_t slave_address, SerialBaudEnum_t BaudSelect, const MODBUS_Map_t *map)
+{
+  uint32_t bit_ticks;
+  uint32_t t15_ticks;
+  uint32_t t35_ticks;
+  
+  MODBUS_Address = slave_address;
+  MODBUS_Map = map;
+  MODBUS_Stats.frames_received = 0;
+  MODBUS_Stats.crc_errors = 0;
+  MODBUS_Stats.framing_errors = 0;
+  MODBUS_Stats.exceptions_sent = 0;
+  
+  SERIAL1_Init(BaudSelect);
+  
+  /*One bit is 4 (BRGS) or 16 Fosc per BRG count, one TMR1 tick is 32 Fosc*/
+  bit_ticks = ((uint32_t)SERIAL1_Config[BaudSelect].BRG_Value + 1) * (SERIAL1_Config[BaudSelect].BRGS_Enable ? 4 : 16) / 32;
+  
+  if (bit_ticks < ((1000000UL * _MODBUS_TMR1_TICKS_PER_US) / 19200)) {
+      t15_ticks = _MODBUS_T15_FIXED_TICKS;    //Spec fixes the intervals above 19200 baud
+      t35_ticks = _MODBUS_T35_FIXED_TICKS;
+  }
+  else {
+      t15_ticks = (bit_ticks * 33) / 2;  //1.5 characters of 11 bits
+      t35_ticks = (bit_ticks * 77) / 2;  //3.5 characters of 11 bits
+  }
+  
+  MODBUS_T35_Preload = (uint16_t)(65536UL - t35_ticks);
+  MODBUS_Gap_Limit = (uint16_t)((bit_ticks * 10) + t15_ticks);  //SERIAL1 sends 10 bit characters
+  
+  TMR1_Enable(DISABLED);
+  TMR1_16bit_ReadWrite_Mode(ENABLED);
+  TMR1_Set_Clock_Source(TMR1_FOSC_D4);
+  TMR1_Set_Prescaler_Rate(TMR1_PRESCALER_1_8);
+  TMR1_Clear_Interrupt_Flag();
+  TMR1_Enable_Interrupt(ENABLED);
+  
+  MODBUS_State = MODBUS_STATE_STARTUP;
+  MODBUS_Timer_Restart();
+  SERIAL1_ISR_RC_Enable(ENABLED);
+}
+
+/******************************************************************************
+* Function : MODBUS_Process()
+* Description: Non-blocking - call from the main loop. Checks a received
+* frame, runs the request against the register map and starts the reply, which
+* is then sent by the U1TX interrupt.
+*******************************************************************************/
+void MODBUS_Process(void)
+{
+  uint16_t length;
+  uint16_t crc;
+  uint8_t address;
+  
+  if (MODBUS_State == MODBUS_STATE_TX_DRAIN) {
+      if (U1ERRIRbits.TXMTIF){MODBUS_State = MODBUS_STATE_IDLE;}
+      return;
+  }
+  
+  if (MODBUS_State != MODBUS_STATE_FRAME_READY){return;}
+  
+  length = MODBUS_Length;
+  address = MODBUS_Buffer[0];
+  
+  if ((address != MODBUS_Address) && (address != _MODBUS_BROADCAST_ADDRESS)) {
+      MODBUS_State = MODBUS_STATE_IDLE;
+      return;
+  }
+  
+  crc = MODBUS_CRC16(MODBUS_Buffer, length - 2);
+  if ((MODBUS_Buffer[length - 2] != (uint8_t)crc) || (MODBUS_Buffer[length - 1] != (uint8_t)(crc >> 8))) {
+      MODBUS_Stats.crc_errors++;
+      MODBUS_State = MODBUS_STATE_IDLE;
+      return;
+  }
+  MODBUS_Stats.frames_received++;
+  
+  length = MODBUS_Execute(length - 2);
+  
+  if (address == _MODBUS_BROADCAST_ADDRESS) {   //Broadcasts are never answered
+      MODBUS_State = MODBUS_STATE_IDLE;
+      return;
+  }
+  
+  crc = MODBUS_CRC16(MODBUS_Buffer, length);
+  MODBUS_Buffer[length++] = (uint8_t)crc;         //CRC is sent low byte first
+  MODBUS_Buffer[length++] = (uint8_t)(crc >> 8);
+  
+  MODBUS_Length = length;
+  MODBUS_TX_Index = 0;
+  MODBUS_State = MODBUS_STATE_TRANSMITTING;
+  SERIAL1_ISR_TX_Enable(ENABLED);
+}
+
+/******************************************************************************
+* Function : MODBUS_GetStats()
+* Description: Frame and error counters since MODBUS_Init().
+*******************************************************************************/
+const MODBUS_Stats_t* MODBUS_GetStats(void)
+{
+  return &MODBUS_Stats;
+}
+
+/******************************************************************************
+* Function : MODBUS_CRC16()
+* Description: CRC-16/MODBUS, init 0xFFFF. Append low byte first.
+*
+* Parameters:
+*   - data (const uint8_t*): Bytes to check.
+*   - length (uint16_t): Number of bytes.
+*
+* Returns:
+*   - uint16_t: CRC value.
+*******************************************************************************/
+uint16_t MODBUS_CRC16(const uint8_t *data, uint16_t length)
+{
+  uint16_t crc = 0xFFFF;
+  
+  while (length--) {
+      crc = (crc >> 8) ^ MODBUS_CRC16_Table[(uint8_t)(crc ^ *data++)];
+  }
+  return crc;
+}
+
+/******************************************************************************
+* Function : MODBUS_Execute()
+* Description: Runs the request in MODBUS_Buffer and builds the response in
+* its place.
+*
+* Parameters:
+*   - length (uint16_t): Request length without the CRC.
+*
+* Returns:
+*   - uint16_t: Response length without the CRC.
+*******************************************************************************/
+uint16_t MODBUS_Execute(uint16_t length)
+{
+  const MODBUS_Map_t *map = MODBUS_Map;
+  MODBUS_Exception_t exception;
+  uint16_t response_length = 6;   //Write functions echo address and quantity
+  uint16_t address;
+  uint16_t count;
+  uint8_t request_length = MODBUS_Request_Length(MODBUS_Buffer[1]);
+  
+  if (request_length == 0) {
+      exception = MODBUS_ILLEGAL_FUNCTION;
+  }
+  else if (length < request_length) {
+      exception = MODBUS_ILLEGAL_DATA_VALUE;
+  }
+  else {
+      address = CORE_Make_16(MODBUS_Buffer[2], MODBUS_Buffer[3]);
+      count = CORE_Make_16(MODBUS_Buffer[4], MODBUS_Buffer[5]);
+      
+      switch (MODBUS_Buffer[1]) {
+        case _MODBUS_READ_COILS:
+            exception = MODBUS_Read_Bits(MODBUS_COILS, map->coils, map->coil_count, address, count, &response_length);
+            break;
+            
+        case _MODBUS_READ_DISCRETE_INPUTS:
+            exception = MODBUS_Read_Bits(MODBUS_DISCRETE_INPUTS, map->discrete_inputs, map->discrete_input_count, address, count, &response_length);
+            break;
+            
+        case _MODBUS_READ_HOLDING_REGISTERS:
+            exception = MODBUS_Read_Registers(MODBUS_HOLDING_REGISTERS, map->holding_registers, map->holding_register_count, address, count, &response_length);
+            break;
+            
+        case _MODBUS_READ_INPUT_REGISTERS:
+            exception = MODBUS_Read_Registers(MODBUS_INPUT_REGISTERS, map->input_registers, map->input_register_count, address, count, &response_length);
+            break;
+            
+        case _MODBUS_WRITE_SINGLE_COIL:  //Value is 0xFF00 (on) or 0x0000 (off)
+            if ((count != 0xFF00) && (count != 0x0000)){exception = MODBUS_ILLEGAL_DATA_VALUE; break;}
+            MODBUS_Buffer[5] = MODBUS_Buffer[4] ? 0x01 : 0x00;  //Pack as one bit
+            exception = MODBUS_Write_Coils(address, 1, &MODBUS_Buffer[5]);
+            MODBUS_Buffer[5] = 0x00;  //Restore the echo
+            break;
+            
+        case _MODBUS_WRITE_SINGLE_REGISTER:
+            exception = MODBUS_Write_Registers(address, 1, &MODBUS_Buffer[4]);
+            break;
+            
+        case _MODBUS_WRITE_MULTIPLE_COILS:
+            if ((count == 0) || (count > 1968) ||
+                (MODBUS_Buffer[6] != ((count + 7) / 8)) || (length < (7 + MODBUS_Buffer[6]))) {
+                exception = MODBUS_ILLEGAL_DATA_VALUE;
+                break;
+            }
+            exception = MODBUS_Write_Coils(address, count, &MODBUS_Buffer[7]);
+            break;
+            
+        case _MODBUS_WRITE_MULTIPLE_REGISTERS:
+            if ((count == 0) || (count > 123) ||
+                (MODBUS_Buffer[6] != (count * 2)) || (length < (7 + MODBUS_Buffer[6]))) {
+                exception = MODBUS_ILLEGAL_DATA_VALUE;
+                break;
+            }
+            exception = MODBUS_Write_Registers(address, count, &MODBUS_Buffer[7]);
+            break;
+            
+        default:
+            exception = MODBUS_ILLEGAL_FUNCTION;
+            break;
+      }
+  }
+  
+  if (exception != MODBUS_NO_EXCEPTION) {
+      MODBUS_Buffer[1] |= 0x80;
+      MODBUS_Buffer[2] = exception;
+      MODBUS_Stats.exceptions_sent++;
+      return 3;
+  }
+  
+  return response_length;
+}
+
+/******************************************************************************
+* Function : MODBUS_Request_Length()
+* Description: Shortest request for a function code, without the CRC, so an
+* unsupported function is reported before a short frame is.
+*
+* Returns:
+*   - uint8_t: 0 for an unsupported function. The multiple writes also carry
+*     a byte count, checked against the frame by MODBUS_Execute().
+*******************************************************************************/
+uint8_t MODBUS_Request_Length(uint8_t function)
+{
+  switch (function) {
+    case _MODBUS_READ_COILS:
+    case _MODBUS_READ_DISCRETE_INPUTS:
+    case _MODBUS_READ_HOLDING_REGISTERS:
+    case _MODBUS_READ_INPUT_REGISTERS:
+    case _MODBUS_WRITE_SINGLE_COIL:
+    case _MODBUS_WRITE_SINGLE_REGISTER:
+        return 6;   //Address, function, starting address, quantity or value
+        
+    case _MODBUS_WRITE_MULTIPLE_COILS:
+    case _MODBUS_WRITE_MULTIPLE_REGISTERS:
+        return 7;   //Plus the byte count
+        
+    default:
+        return 0;
+  }
+}
+
+/******************************************************************************
+* Function : MODBUS_Read_Bits()
+* Description: Builds a read coils / read discrete inputs response.
+*******************************************************************************/
+MODBUS_Exception_t MODBUS_Read_Bits(MODBUS_Table_t table, const uint8_t *bits, uint16_t bit_count, uint16_t address, uint16_t count, uint16_t *response_length)
+{
+  MODBUS_Exception_t exception;
+  uint8_t byte_count;
+  uint16_t bit;
+  
+  if ((count == 0) || (count > 2000)){return MODBUS_ILLEGAL_DATA_VALUE;}
+  if ((bits == NULL) || (((uint32_t)address + count) > bit_count)){return MODBUS_ILLEGAL_DATA_ADDRESS;}
+  
+  exception = MODBUS_Before_Read(table, address, count);
+  if (exception != MODBUS_NO_EXCEPTION){return exception;}
+  
+  byte_count = (uint8_t)((count + 7) / 8);
+  MODBUS_Buffer[2] = byte_count;
+  for (uint8_t i = 0; i < byte_count; i++){MODBUS_Buffer[3 + i] = 0x00;}
+  
+  for (uint16_t i = 0; i < count; i++) {
+      bit = address + i;
+      if (bits[bit >> 3] & (1 << (bit & 0x07))) {
+          MODBUS_Buffer[3 + (i >> 3)] |= (uint8_t)(1 << (i & 0x07));
+      }
+  }
+  
+  *response_length = 3 + byte_count;
+  return MODBUS_NO_EXCEPTION;
+}
+
+/******************************************************************************
+* Function : MODBUS_Read_Registers()
+* Description: Builds a read holding / read input registers response.
+*******************************************************************************/
+MODBUS_Exception_t MODBUS_Read_Registers(MODBUS_Table_t table, const uint16_t *registers, uint16_t register_count, uint16_t address, uint16_t count, uint16_t *response_length)
+{
+  MODBUS_Exception_t exception;
+  uint8_t *response = &MODBUS_Buffer[3];
+  
+  if ((count == 0) || (count > 125)){return MODBUS_ILLEGAL_DATA_VALUE;}
+  if ((registers == NULL) || (((uint32_t)address + count) > register_count)){return MODBUS_ILLEGAL_DATA_ADDRESS;}
+  
+  exception = MODBUS_Before_Read(table, address, count);
+  if (exception != MODBUS_NO_EXCEPTION){return exception;}
+  
+  MODBUS_Buffer[2] = (uint8_t)(count * 2);
+  for (uint8_t i = 0; i < count; i++) {
+      *response++ = (uint8_t)(registers[address + i] >> 8);  //Registers are sent high byte first
+      *response++ = (uint8_t)(registers[address + i]);
+  }
+  
+  *response_length = 3 + (count * 2);
+  return MODBUS_NO_EXCEPTION;
+}
+
+/******************************************************************************
+* Function : MODBUS_Write_Coils()
+* Description: Stores bit packed coil values from the request.
+*******************************************************************************/
+MODBUS_Exception_t MODBUS_Write_Coils(uint16_t address, uint16_t count, const uint8_t *values)
+{
+  uint8_t *coils = MODBUS_Map->coils;
+  uint16_t bit;
+  
+  if ((coils == NULL) || (((uint32_t)address + count) > MODBUS_Map->coil_count)){return MODBUS_ILLEGAL_DATA_ADDRESS;}
+  
+  for (uint16_t i = 0; i < count; i++) {
+      bit = address + i;
+      if (values[i >> 3] & (1 << (i & 0x07))){coils[bit >> 3] |= (uint8_t)(1 << (bit & 0x07));}
+      else {coils[bit >> 3] &= (uint8_t)~(1 << (bit & 0x07));}
+  }
+  
+  return MODBUS_After_Write(MODBUS_COILS, address, count);
+}
+
+/******************************************************************************
+* Function : MODBUS_Write_Registers()
+* Description: Stores high byte first register values from the request.
+*******************************************************************************/
+MODBUS_Exception_t MODBUS_Write_Registers(uint16_t address, uint16_t count, const uint8_t *values)
+{
+  uint16_t *registers = MODBUS_Map->holding_registers;
+  
+  if ((registers == NULL) || (((uint32_t)address + count) > MODBUS_Map->holding_register_count)){return MODBUS_ILLEGAL_DATA_ADDRESS;}
+  
+  for (uint8_t i = 0; i < count; i++) {
+      registers[address + i] = CORE_Make_16(values[0], values[1]);
+      values += 2;
+  }
+  
+  return MODBUS_After_Write(MODBUS_HOLDING_REGISTERS, address, count);
+}
+
+/******************************************************************************
+* Function : MODBUS_Before_Read() / MODBUS_After_Write()
+* Description: Calls the application callbacks when they are set.
+*******************************************************************************/
+MODBUS_Exception_t MODBUS_Before_Read(MODBUS_Table_t table, uint16_t address, uint16_t count)
+{
+  if (MODBUS_Map->before_read == NULL){return MODBUS_NO_EXCEPTION;}
+  return MODBUS_Map->before_read(table, address, count);
+}
+
+MODBUS_Exception_t MODBUS_After_Write(MODBUS_Table_t table, uint16_t address, uint16_t count)
+{
+  if (MODBUS_Map->after_write == NULL){return MODBUS_NO_EXCEPTION;}
+  return MODBUS_Map->after_write(table, address, count);
+}
+
+/******************************************************************************
+* Function : MODBUS_Timer_Restart()
+* Description: Starts a fresh t3.5 period on TMR1. Registers are written
+* directly as this runs in the RX interrupt.
+*******************************************************************************/
+void MODBUS_Timer_Restart(void)
+{
+  T1CONbits.ON = CLEAR;
+  TMR1H = (uint8_t)(MODBUS_T35_Preload >> 8);  //Buffered until TMR1L is written
+  TMR1L = (uint8_t)MODBUS_T35_Preload;
+  PIR3bits.TMR1IF = CLEAR;
+  T1CONbits.ON = SET;
+}
+
+/******************************************************************************
+* Function : MODBUS_RX_ISR()
+* Description: Called from the U1RX vector. Collects bytes into the frame,
+* flags a gap longer than t1.5 or a UART error, and restarts the t3.5 timer.
+*******************************************************************************/
+void MODBUS_RX_ISR(void)
+{
+  uint16_t elapsed;
+  uint8_t low;
+  uint8_t errors;
+  uint8_t data;
+  
+  while (!U1FIFObits.RXBE) {
+      errors = U1ERRIRbits.FERIF | U1ERRIRbits.RXFOIF;
+      U1ERRIRbits.RXFOIF = CLEAR;
+      data = U1RXB;
+      
+      switch (MODBUS_State) {
+        case MODBUS_STATE_IDLE:   //First byte of a frame
+            MODBUS_Length = 0;
+            MODBUS_Frame_Error = false;
+            MODBUS_State = MODBUS_STATE_RECEIVING;
+            break;
+            
+        case MODBUS_STATE_RECEIVING:
+            low = TMR1L;  //Reading TMR1L latches TMR1H
+            elapsed = (uint16_t)(((uint16_t)TMR1H << 8) | low) - MODBUS_T35_Preload;
+            if (elapsed > MODBUS_Gap_Limit){MODBUS_Frame_Error = true;}
+            break;
+            
+        case MODBUS_STATE_STARTUP:  //Line not quiet yet - keep waiting for t3.5
+            MODBUS_Timer_Restart();
+            continue;
+            
+        default:  //A frame is being handled or a reply sent - drop it
+            continue;
+      }
+      
+      if (errors){MODBUS_Frame_Error = true;}
+      
+      if (MODBUS_Length < _MODBUS_ADU_SIZE){MODBUS_Buffer[MODBUS_Length++] = data;}
+      else {MODBUS_Frame_Error = true;}
+      
+      MODBUS_Timer_Restart();
+  }
+}
+
+/******************************************************************************
+* Function : MODBUS_TX_ISR()
+* Description: Called from the U1TX vector - keeps the transmit FIFO full
+* until the reply has been handed to the UART.
+*******************************************************************************/
+void MODBUS_TX_ISR(void)
+{
+  while (!U1FIFObits.TXBF) {
+      if (MODBUS_TX_Index >= MODBUS_Length) {
+          PIE4bits.U1TXIE = CLEAR;
+          MODBUS_State = MODBUS_STATE_TX_DRAIN;
+          return;
+      }
+      U1TXB = MODBUS_Buffer[MODBUS_TX_Index++];
+  }
+}
+
+/******************************************************************************
+* Function : MODBUS_Timer_ISR()
+* Description: Called from the TMR1 vector - t3.5 of silence ends the frame.
+*******************************************************************************/
+void MODBUS_Timer_ISR(void)
+{
+  T1CONbits.ON = CLEAR;
+  PIR3bits.TMR1IF = CLEAR;
+  
+  if (MODBUS_State == MODBUS_STATE_RECEIVING) {
+      if (MODBUS_Frame_Error || (MODBUS_Length < 4)) {   //Address + Function + CRC is the shortest frame
+          MODBUS_Stats.framing_errors++;
+          MODBUS_State = MODBUS_STATE_IDLE;
+      }
+      else {MODBUS_State = MODBUS_STATE_FRAME_READY;}
+  }
+  else if (MODBUS_State == MODBUS_STATE_STARTUP){MODBUS_State = MODBUS_STATE_IDLE;}
+}
+
+/*** End of File **************************************************************/
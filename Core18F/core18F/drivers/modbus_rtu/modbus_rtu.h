@@ -0,0 +1,149 @@
+/****************************************************************************
+* Title                 :   Modbus RTU Slave
+* Filename              :   modbus_rtu.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+#ifndef _CORE18F_MODBUS_RTU_H
+#define _CORE18F_MODBUS_RTU_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core18F.h"
+#include "../../hal/tmr1/tmr1.h"
+#include "../../hal/serial1/serial1_isr.h"
+
+#ifndef _CORE18F_MODBUS_RTU_ENABLE
+    #error "Define _CORE18F_MODBUS_RTU_ENABLE in the device config - it hooks the U1RX, U1TX and TMR1 vectors"
+#endif
+
+#ifndef _CORE18F_HAL_SERIAL1_ISR_ENABLE
+    #error "Modbus RTU needs SERIAL1 interrupts - define _CORE18F_HAL_SERIAL1_ISR_ENABLE"
+#endif
+
+/******************************************************************************
+* Configuration
+*******************************************************************************/
+#define _MODBUS_ADU_SIZE 256            //Largest RTU frame - Address + PDU + CRC
+#define _MODBUS_BROADCAST_ADDRESS 0x00
+
+/*Silent intervals in TMR1 ticks (Fosc/4, 1:8 - 0.5us at 64MHz)*/
+#define _MODBUS_TMR1_TICKS_PER_US ((_XTAL_FREQ / 4) / 8 / 1000000)
+#define _MODBUS_T15_FIXED_TICKS (750 * _MODBUS_TMR1_TICKS_PER_US)   //Fixed above 19200 baud
+#define _MODBUS_T35_FIXED_TICKS (1750 * _MODBUS_TMR1_TICKS_PER_US)
+
+/*Function codes*/
+#define _MODBUS_READ_COILS 0x01
+#define _MODBUS_READ_DISCRETE_INPUTS 0x02
+#define _MODBUS_READ_HOLDING_REGISTERS 0x03
+#define _MODBUS_READ_INPUT_REGISTERS 0x04
+#define _MODBUS_WRITE_SINGLE_COIL 0x05
+#define _MODBUS_WRITE_SINGLE_REGISTER 0x06
+#define _MODBUS_WRITE_MULTIPLE_COILS 0x0F
+#define _MODBUS_WRITE_MULTIPLE_REGISTERS 0x10
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  MODBUS_NO_EXCEPTION = 0x00,
+  MODBUS_ILLEGAL_FUNCTION = 0x01,
+  MODBUS_ILLEGAL_DATA_ADDRESS = 0x02,
+  MODBUS_ILLEGAL_DATA_VALUE = 0x03,
+  MODBUS_SERVER_DEVICE_FAILURE = 0x04
+}MODBUS_Exception_t;
+
+typedef enum
+{
+  MODBUS_COILS,
+  MODBUS_DISCRETE_INPUTS,
+  MODBUS_HOLDING_REGISTERS,
+  MODBUS_INPUT_REGISTERS
+}MODBUS_Table_t;
+
+/*Application data - coils and discrete inputs are bit packed, bit 0 of byte 0 is address 0.
+ *Callbacks are optional (NULL) and run from MODBUS_Process() in the main loop.
+ *before_read can refresh the values about to be sent, after_write sees values already stored.*/
+typedef struct
+{
+  uint8_t *coils;
+  uint16_t coil_count;
+  uint8_t *discrete_inputs;
+  uint16_t discrete_input_count;
+  uint16_t *holding_registers;
+  uint16_t holding_register_count;
+  uint16_t *input_registers;
+  uint16_t input_register_count;
+  MODBUS_Exception_t (*before_read)(MODBUS_Table_t table, uint16_t address, uint16_t count);
+  MODBUS_Exception_t (*after_write)(MODBUS_Table_t table, uint16_t address, uint16_t count);
+}MODBUS_Map_t;
+
+typedef struct
+{
+  uint16_t frames_received;     //Addressed to this node with a good CRC
+  uint16_t crc_errors;
+  uint16_t framing_errors;      //t1.5 gaps, UART errors and oversize frames
+  uint16_t exceptions_sent;
+}MODBUS_Stats_t;
+
+/******************************************************************************
+***** MODBUS Interface
+*******************************************************************************/
+typedef struct {
+  void (*Initialize)(uint8_t slave_address, SerialBaudEnum_t BaudSelect, const MODBUS_Map_t *map);
+  void (*Process)(void);
+  const MODBUS_Stats_t* (*GetStats)(void);
+  uint16_t (*CRC16)(const uint8_t *data, uint16_t length);
+}MODBUS_Interface_t;
+
+extern const MODBUS_Interface_t MODBUS;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void MODBUS_Init(uint8_t slave_address, SerialBaudEnum_t BaudSelect, const MODBUS_Map_t *map);
+void MODBUS_Process(void);
+const MODBUS_Stats_t* MODBUS_GetStats(void);
+uint16_t MODBUS_CRC16(const uint8_t *data, uint16_t length);
+
+/*Called from the U1RX, U1TX and TMR1 interrupt vectors*/
+void MODBUS_RX_ISR(void);
+void MODBUS_TX_ISR(void);
+void MODBUS_Timer_ISR(void);
+
+#endif /*_CORE18F_MODBUS_RTU_H*/
+
+/*** End of File **************************************************************/
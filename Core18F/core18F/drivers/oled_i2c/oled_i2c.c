@@ -0,0 +1,682 @@
+/****************************************************************************
+* Title                 :   OLED I2C Driver - SSD1306 / SH1106
+* Filename              :   oled_i2c.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "oled_i2c.h"
+
+/******************************************************************************
+* Interface
+*******************************************************************************/
+const OLED_Interface_t OLED = {
+  .Initialize = &OLED_I2C_Init,
+  .Display = &OLED_I2C_Display,
+  .Contrast = &OLED_I2C_Contrast,
+  .Clear = &OLED_I2C_Clear,
+  .Pixel = &OLED_I2C_Pixel,
+  .Write_Character = &OLED_I2C_Write_Character,
+  .Write = &OLED_I2C_Write_String,
+  .Flush = &OLED_I2C_Flush,
+  #ifdef _OLED_BACKGROUND_REFRESH_ENABLE
+    .Refresh_Start = &OLED_I2C_Refresh_Start,
+    .Refresh_Stop = &OLED_I2C_Refresh_Stop,
+    .Refresh_IsIdle = &OLED_I2C_Refresh_IsIdle,
+  #endif
+};
+
+/******************************************************************************
+* Controller Setup - one command write each
+*******************************************************************************/
+const uint8_t OLED_Setup_SSD1306[] = {
+  _OLED_CONTROL_COMMANDS,
+  _OLED_CMD_DISPLAY_OFF,
+  0xD5, 0x80,                   //Clock divide and oscillator - reset value
+  0xA8, (_OLED_HEIGHT - 1),     //Multiplex ratio
+  0xD3, 0x00,                   //No display offset
+  0x40,                         //Start line 0
+  0x8D, 0x14,                   //Charge pump on
+  0x20, 0x00,                   //Horizontal addressing
+  0xA1,                         //Segment remap - column 0 on the left
+  0xC8,                         //COM scan from the bottom - page 0 at the top
+  0xDA, _OLED_COM_PINS,
+  _OLED_CMD_SET_CONTRAST, _OLED_CONTRAST,
+  0xD9, 0xF1,                   //Pre-charge for the charge pump
+  0xDB, 0x40,                   //VCOMH deselect level
+  0xA4,                         //Show the RAM
+  0xA6,                         //Not inverted
+  _OLED_CMD_DISPLAY_ON
+};
+
+const uint8_t OLED_Setup_SH1106[] = {
+  _OLED_CONTROL_COMMANDS,
+  _OLED_CMD_DISPLAY_OFF,
+  0xD5, 0x80,                   //Clock divide and oscillator
+  0xA8, (_OLED_HEIGHT - 1),     //Multiplex ratio
+  0xD3, 0x00,                   //No display offset
+  0x40,                         //Start line 0
+  0xAD, 0x8B,                   //DC-DC converter on
+  0xA1,                         //Segment remap - column 0 on the left
+  0xC8,                         //COM scan from the bottom - page 0 at the top
+  0xDA, _OLED_COM_PINS,
+  _OLED_CMD_SET_CONTRAST, _OLED_CONTRAST,
+  0xD9, 0x22,                   //Pre-charge - reset value
+  0xDB, 0x35,                   //VCOM deselect level - reset value
+  0xA4,                         //Show the RAM
+  0xA6,                         //Not inverted
+  _OLED_CMD_DISPLAY_ON
+};
+
+/******************************************************************************
+* 5x7 Font - 0x20 to 0x7F, one byte per column, bit 0 at the top
+*******************************************************************************/
+const uint8_t OLED_Font_5x7[][_OLED_FONT_WIDTH] = {
+  {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},  // ' ' ! " #
+  {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x55,0x22,0x50}, {0x00,0x05,0x03,0x00,0x00},  // $ % & '
+  {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x08,0x2A,0x1C,0x2A,0x08}, {0x08,0x08,0x3E,0x08,0x08},  // ( ) * +
+  {0x00,0x50,0x30,0x00,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x60,0x60,0x00,0x00}, {0x20,0x10,0x08,0x04,0x02},  // , - . /
+  {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x42,0x61,0x51,0x49,0x46}, {0x21,0x41,0x45,0x4B,0x31},  // 0 1 2 3
+  {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x30}, {0x01,0x71,0x09,0x05,0x03},  // 4 5 6 7
+  {0x36,0x49,0x49,0x49,0x36}, {0x06,0x49,0x49,0x29,0x1E}, {0x00,0x36,0x36,0x00,0x00}, {0x00,0x56,0x36,0x00,0x00},  // 8 9 : ;
+  {0x08,0x14,0x22,0x41,0x00}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x51,0x09,0x06},  // < = > ?
+  {0x32,0x49,0x79,0x41,0x3E}, {0x7E,0x11,0x11,0x11,0x7E}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},  // @ A B C
+  {0x7F,0x41,0x41,0x22,0x1C}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x49,0x49,0x7A},  // D E F G
+  {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},  // H I J K
+  {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x0C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},  // L M N O
+  {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x46,0x49,0x49,0x49,0x31},  // P Q R S
+  {0x01,0x01,0x7F,0x01,0x01}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},  // T U V W
+  {0x63,0x14,0x08,0x14,0x63}, {0x07,0x08,0x70,0x08,0x07}, {0x61,0x51,0x49,0x45,0x43}, {0x00,0x7F,0x41,0x41,0x00},  // X Y Z [
+  {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x7F,0x00}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},  // \ ] ^ _
+  {0x00,0x01,0x02,0x04,0x00}, {0x20,0x54,0x54,0x54,0x78}, {0x7F,0x48,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x20},  // ` a b c
+  {0x38,0x44,0x44,0x48,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x08,0x7E,0x09,0x01,0x02}, {0x0C,0x52,0x52,0x52,0x3E},  // d e f g
+  {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x44,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},  // h i j k
+  {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x18,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},  // l m n o
+  {0x7C,0x14,0x14,0x14,0x08}, {0x08,0x14,0x14,0x18,0x7C}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x20},  // p q r s
+  {0x04,0x3F,0x44,0x40,0x20}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},  // t u v w
+  {0x44,0x28,0x10,0x28,0x44}, {0x0C,0x50,0x50,0x50,0x3C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},  // x y z {
+  {0x00,0x00,0x7F,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x08,0x04,0x08,0x10,0x08}, {0x00,0x06,0x09,0x09,0x06}   // | } ~ degree
+};
+
+/******************************************************************************
+* Global Variables
+*******************************************************************************/
+#ifdef _OLED_BACKGROUND_REFRESH_ENABLE
+OLED_Device_t *OLED_Refresh_List[_OLED_REFRESH_MAX_DISPLAYS];      //Displays being refreshed, NULL for a free slot
+uint8_t OLED_Refresh_Next;                                        //Slot the next write starts looking from
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+I2C1_Transaction_t OLED_Refresh_Transaction;
+uint8_t OLED_Refresh_Buffer[_OLED_PREFIX_MAX + _OLED_WIDTH];       //Prefix and page data of the write on the bus
+OLED_Device_t *OLED_Refresh_Sending;                              //Display the write on the bus belongs to
+#endif
+#endif
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Commands(OLED_Device_t *oled, const uint8_t *commands, uint8_t length);
+OLED_Status_Enum_t OLED_I2C_Bus_Write(OLED_Device_t *oled, const I2C1_Segment_t *segments, uint8_t segment_count);
+void OLED_I2C_Put_Column(OLED_Device_t *oled, uint8_t page, uint8_t column, uint8_t bits);
+void OLED_I2C_Mark(OLED_Device_t *oled, uint8_t page, uint8_t first, uint8_t last);
+void OLED_I2C_Mark_All(OLED_Device_t *oled);
+bool OLED_I2C_Page_Dirty(OLED_Device_t *oled, uint8_t page);
+bool OLED_I2C_Run_Start(OLED_Device_t *oled);
+uint8_t OLED_I2C_Prepare(OLED_Device_t *oled, uint8_t *prefix);
+void OLED_I2C_Sent(OLED_Device_t *oled, bool sent);
+#ifdef _OLED_BACKGROUND_REFRESH_ENABLE
+void OLED_I2C_Refresh_Slice(void);
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+void OLED_I2C_Refresh_Done(I2C1_Transaction_t *transaction);
+#endif
+#endif
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+
+/******************************************************************************
+* Function : OLED_I2C_Init()
+* Description: Starts I2C1, sets up the controller, clears the framebuffer
+* and the glass.
+*
+* @param oled - The display - see OLED_I2C_SSD1306().
+* @return OLED_Status_Enum_t - OLED_GENERIC_ERROR if the display does not answer.
+*
+* Example:
+*   OLED_Device_t Panel = OLED_I2C_SSD1306(0x3C);
+*   OLED.Initialize(&Panel);
+*   OLED.Write(&Panel, 0, 0, "Hello");
+*   OLED.Flush(&Panel);
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Init(OLED_Device_t *oled)
+{
+  OLED_Status_Enum_t OLED_Status;
+  
+  // Nothing dirty and no run - the struct may hold leftovers from an earlier Init
+  for (uint8_t page = 0; page < _OLED_PAGES; page++) {
+    oled->dirty_first[page] = _OLED_WIDTH;
+    oled->dirty_last[page] = 0;
+    }
+  oled->run_remaining = 0;
+  
+  I2C1_MASTER.Initialize();
+  __delay_ms(_OLED_POWER_UP_DELAY_MS);
+  
+  if (oled->controller == OLED_CONTROLLER_SH1106) {
+    OLED_Status = OLED_I2C_Commands(oled, OLED_Setup_SH1106, sizeof(OLED_Setup_SH1106));
+    }
+  else {
+    OLED_Status = OLED_I2C_Commands(oled, OLED_Setup_SSD1306, sizeof(OLED_Setup_SSD1306));
+    }
+  if (OLED_Status != OLED_OK){return OLED_Status;}
+  
+  OLED_I2C_Clear(oled);
+  OLED_I2C_Mark_All(oled);   // RAM is random at power up
+  return OLED_I2C_Flush(oled);
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Display()
+* Description: Turns the panel on or off - the RAM is kept while off.
+*
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Display(OLED_Device_t *oled, LogicEnum_t set_display)
+{
+  uint8_t command[2] = {_OLED_CONTROL_COMMANDS, _OLED_CMD_DISPLAY_OFF};
+  
+  if (set_display == ON){command[1] = _OLED_CMD_DISPLAY_ON;}
+  return OLED_I2C_Commands(oled, command, sizeof(command));
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Contrast()
+* Description: Sets the panel brightness, 0-255.
+*
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Contrast(OLED_Device_t *oled, uint8_t level)
+{
+  uint8_t command[3] = {_OLED_CONTROL_COMMANDS, _OLED_CMD_SET_CONTRAST, 0};
+  
+  command[2] = level;
+  return OLED_I2C_Commands(oled, command, sizeof(command));
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Clear()
+* Description: Blanks the framebuffer - only columns that were lit are marked.
+*
+*******************************************************************************/
+void OLED_I2C_Clear(OLED_Device_t *oled)
+{
+  for (uint8_t page = 0; page < _OLED_PAGES; page++) {
+    for (uint8_t column = 0; column < _OLED_WIDTH; column++){OLED_I2C_Put_Column(oled, page, column, 0x00);}
+    }
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Pixel()
+* Description: Sets or clears one pixel, 0,0 is the top left.
+*
+* @return OLED_Status_Enum_t - OLED_GENERIC_ERROR if x, y is off the panel.
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Pixel(OLED_Device_t *oled, uint8_t x, uint8_t y, LogicEnum_t set_pixel)
+{
+  uint8_t page, mask;
+  
+  if ((x >= _OLED_WIDTH) || (y >= _OLED_HEIGHT)){return OLED_GENERIC_ERROR;}
+  
+  page = y >> 3;
+  mask = (uint8_t)(1 << (y & 0x07));
+  
+  if (set_pixel == ON){OLED_I2C_Put_Column(oled, page, x, oled->frame[page][x] | mask);}
+  else {OLED_I2C_Put_Column(oled, page, x, oled->frame[page][x] & (uint8_t)~mask);}
+  return OLED_OK;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Write_Character()
+* Description: Draws a character at a text row (page) and pixel column.
+*
+* @param oled - The display.
+* @param row - Text row, 0 to _OLED_PAGES - 1.
+* @param column - Pixel column of the left edge.
+* @param character - The character, see the font notes in oled_i2c.h.
+*
+* @return OLED_Status_Enum_t - OLED_GENERIC_ERROR if it does not fit.
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Write_Character(OLED_Device_t *oled, uint8_t row, uint8_t column, uint8_t character)
+{
+  const uint8_t *glyph;
+  
+  if ((row >= _OLED_PAGES) || (column > (_OLED_WIDTH - _OLED_CHAR_WIDTH))){return OLED_GENERIC_ERROR;}
+  
+  if ((character < _OLED_FONT_FIRST) || (character > _OLED_FONT_LAST)){character = ' ';}
+  glyph = OLED_Font_5x7[character - _OLED_FONT_FIRST];
+  
+  for (uint8_t i = 0; i < _OLED_FONT_WIDTH; i++){OLED_I2C_Put_Column(oled, row, column + i, glyph[i]);}
+  OLED_I2C_Put_Column(oled, row, column + _OLED_FONT_WIDTH, 0x00);
+  return OLED_OK;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Write_String()
+* Description: Draws a string from row, column - stops at the right edge.
+*
+* @return OLED_Status_Enum_t - OLED_GENERIC_ERROR if the string was cut short.
+*
+* Example:
+*   OLED.Write(&Panel, 2, 0, "Temp");
+*   OLED.Write_Character(&Panel, 2, 30, 0x7F);   //Degree sign
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Write_String(OLED_Device_t *oled, uint8_t row, uint8_t column, char *StringData)
+{
+  while (*StringData != '\0') {
+    if (OLED_I2C_Write_Character(oled, row, column, (uint8_t)*StringData) != OLED_OK){return OLED_GENERIC_ERROR;}
+    column += _OLED_CHAR_WIDTH;
+    StringData++;
+    }
+  return OLED_OK;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Flush()
+* Description: Sends the dirty parts of the framebuffer and waits for them.
+* A clean framebuffer costs no bus traffic.
+*
+* @return OLED_Status_Enum_t - OLED_GENERIC_ERROR on a failed write, the whole
+* framebuffer is sent again next time.
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Flush(OLED_Device_t *oled)
+{
+  uint8_t prefix[_OLED_PREFIX_MAX];
+  I2C1_Segment_t segments[2];
+  
+  while ((segments[0].length = OLED_I2C_Prepare(oled, prefix)) > 0) {
+    // Prefix and the page straight from the framebuffer - no copy
+    segments[0].data = prefix;
+    segments[1].data = &oled->frame[oled->run_page][oled->run_first];
+    segments[1].length = (uint8_t)(oled->run_last - oled->run_first + 1);
+    
+    if (OLED_I2C_Bus_Write(oled, segments, 2) != OLED_OK) {
+      OLED_I2C_Sent(oled, false);
+      return OLED_GENERIC_ERROR;
+      }
+    OLED_I2C_Sent(oled, true);
+    }
+  return OLED_OK;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Commands()
+* Description: One blocking write - the first byte is the control byte.
+*
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Commands(OLED_Device_t *oled, const uint8_t *commands, uint8_t length)
+{
+  I2C1_Segment_t segment;
+  
+  segment.data = commands;
+  segment.length = length;
+  return OLED_I2C_Bus_Write(oled, &segment, 1);
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Bus_Write()
+* Description: Every blocking write goes through here. With the I2C1 presence
+* cache a display known to be missing is skipped without touching the bus,
+* and a failed write drops its cache entry so the next write probes again.
+*
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Bus_Write(OLED_Device_t *oled, const I2C1_Segment_t *segments, uint8_t segment_count)
+{
+#ifdef _CORE18F_HAL_I2C1_PRESENCE_ENABLE
+  if (!I2C1_PRESENCE.IsPresent(oled->address)){return OLED_GENERIC_ERROR;}
+#endif
+  
+  if (I2C1_MASTER.WriteVector(oled->address, segments, segment_count) != I2C_OK) {
+#ifdef _CORE18F_HAL_I2C1_PRESENCE_ENABLE
+    I2C1_PRESENCE.Invalidate(oled->address);
+#endif
+    return OLED_GENERIC_ERROR;
+    }
+  return OLED_OK;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Put_Column()
+* Description: Stores one column byte of a page, marking it only if it changed.
+*
+*******************************************************************************/
+void OLED_I2C_Put_Column(OLED_Device_t *oled, uint8_t page, uint8_t column, uint8_t bits)
+{
+  if (oled->frame[page][column] == bits){return;}
+  
+  oled->frame[page][column] = bits;
+  OLED_I2C_Mark(oled, page, column, column);
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Mark()
+* Description: Widens a page's dirty range to take in first to last.
+*
+*******************************************************************************/
+void OLED_I2C_Mark(OLED_Device_t *oled, uint8_t page, uint8_t first, uint8_t last)
+{
+  if (!OLED_I2C_Page_Dirty(oled, page)) {
+    oled->dirty_first[page] = first;
+    oled->dirty_last[page] = last;
+    return;
+    }
+  if (first < oled->dirty_first[page]){oled->dirty_first[page] = first;}
+  if (last > oled->dirty_last[page]){oled->dirty_last[page] = last;}
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Mark_All()
+* Description: Marks the whole framebuffer to be sent - after power up or a
+* failed write, when the glass is unknown.
+*
+*******************************************************************************/
+void OLED_I2C_Mark_All(OLED_Device_t *oled)
+{
+  for (uint8_t page = 0; page < _OLED_PAGES; page++){OLED_I2C_Mark(oled, page, 0, _OLED_WIDTH - 1);}
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Page_Dirty()
+* Description: true if the page has columns to send.
+*
+*******************************************************************************/
+bool OLED_I2C_Page_Dirty(OLED_Device_t *oled, uint8_t page)
+{
+  return (oled->dirty_first[page] <= oled->dirty_last[page]);
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Run_Start()
+* Description: Takes the first dirty page and, on an SSD1306, the dirty pages
+* straight after it as one run with a shared column window. Their dirty ranges
+* are cleared - drawing from here on marks them again.
+*
+* @return bool - false if nothing is dirty.
+*******************************************************************************/
+bool OLED_I2C_Run_Start(OLED_Device_t *oled)
+{
+  uint8_t page = 0;
+  
+  while (!OLED_I2C_Page_Dirty(oled, page)) {
+    if (++page >= _OLED_PAGES){return false;}
+    }
+  
+  oled->run_page = page;
+  oled->run_remaining = 0;
+  oled->run_first = oled->dirty_first[page];
+  oled->run_last = oled->dirty_last[page];
+  
+  do {
+    if (oled->dirty_first[page] < oled->run_first){oled->run_first = oled->dirty_first[page];}
+    if (oled->dirty_last[page] > oled->run_last){oled->run_last = oled->dirty_last[page];}
+    oled->dirty_first[page] = _OLED_WIDTH;   // Clean
+    oled->dirty_last[page] = 0;
+    oled->run_remaining++;
+    page++;
+    } while ((oled->controller == OLED_CONTROLLER_SSD1306) && (page < _OLED_PAGES) && OLED_I2C_Page_Dirty(oled, page));
+  
+  return true;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Prepare()
+* Description: Sets up the next write - run_page, run_first to run_last - and
+* builds its prefix: the addressing commands at the start of a run, then the
+* data control byte. Commands ride in the same write behind Co = 1 control
+* bytes, so a page is always one I2C write.
+*
+* @return uint8_t - Prefix length, 0 if nothing is dirty.
+*******************************************************************************/
+uint8_t OLED_I2C_Prepare(OLED_Device_t *oled, uint8_t *prefix)
+{
+  uint8_t length = 0;
+  uint8_t column;
+  
+  if (oled->run_remaining == 0) {
+    if (!OLED_I2C_Run_Start(oled)){return 0;}
+    
+    if (oled->controller == OLED_CONTROLLER_SH1106) {
+      column = oled->run_first + _OLED_SH1106_COLUMN_OFFSET;
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = (uint8_t)(_OLED_CMD_SET_PAGE | oled->run_page);
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = (uint8_t)(_OLED_CMD_COLUMN_LOW | (column & 0x0F));
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = (uint8_t)(_OLED_CMD_COLUMN_HIGH | (column >> 4));
+      }
+    else {
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = _OLED_CMD_COLUMN_RANGE;
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = oled->run_first;
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = oled->run_last;
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = _OLED_CMD_PAGE_RANGE;
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = oled->run_page;
+      prefix[length++] = _OLED_CONTROL_COMMAND;
+      prefix[length++] = (uint8_t)(oled->run_page + oled->run_remaining - 1);
+      }
+    }
+  
+  prefix[length++] = _OLED_CONTROL_DATA;
+  return length;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Sent()
+* Description: Moves the run on after a write. A failed write leaves the
+* controller's address unknown and the glass with it - the run is dropped and
+* everything is sent again.
+*
+*******************************************************************************/
+void OLED_I2C_Sent(OLED_Device_t *oled, bool sent)
+{
+  if (!sent) {
+    oled->run_remaining = 0;
+    OLED_I2C_Mark_All(oled);
+    return;
+    }
+  
+  oled->run_page++;
+  oled->run_remaining--;
+}
+
+#ifdef _OLED_BACKGROUND_REFRESH_ENABLE
+/******************************************************************************
+* Function : OLED_I2C_Refresh_Start()
+* Description: Starts sending a display's dirty pages from the event system.
+* The display must already be initialized. Up to _OLED_REFRESH_MAX_DISPLAYS
+* displays take turns, one page write each.
+*
+* @return OLED_Status_Enum_t - OLED_GENERIC_ERROR if every slot is in use.
+*
+* Example:
+*   OLED.Initialize(&Panel);
+*   OLED.Refresh_Start(&Panel);
+*   ...
+*   OLED.Write(&Panel, 0, 0, "Running");   //Appears within a few ms
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Refresh_Start(OLED_Device_t *oled)
+{
+  uint8_t free_slot = _OLED_REFRESH_MAX_DISPLAYS;
+  bool running = false;  // Another display already has the event
+  
+  for (uint8_t slot = 0; slot < _OLED_REFRESH_MAX_DISPLAYS; slot++) {
+    if (OLED_Refresh_List[slot] == oled){return OLED_OK;}
+    if (OLED_Refresh_List[slot] != NULL){running = true;}
+    else if (free_slot == _OLED_REFRESH_MAX_DISPLAYS){free_slot = slot;}
+    }
+  if (free_slot == _OLED_REFRESH_MAX_DISPLAYS){return OLED_GENERIC_ERROR;}
+  
+  OLED_Refresh_List[free_slot] = oled;
+  if (running){return OLED_OK;}
+  
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+  OLED_Refresh_Transaction.status = I2C_OK;
+#endif
+  
+  CORE.Events_Add(_OLED_REFRESH_INTERVAL_MS, &OLED_I2C_Refresh_Slice, _OLED_REFRESH_INTERVAL_MS);
+  return OLED_OK;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Refresh_Stop()
+* Description: Stops the background refresh of a display. A write already on
+* the bus (async) still completes.
+*
+*******************************************************************************/
+void OLED_I2C_Refresh_Stop(OLED_Device_t *oled)
+{
+  bool running = false;
+  
+  for (uint8_t slot = 0; slot < _OLED_REFRESH_MAX_DISPLAYS; slot++) {
+    if (OLED_Refresh_List[slot] == oled){OLED_Refresh_List[slot] = NULL;}
+    if (OLED_Refresh_List[slot] != NULL){running = true;}
+    }
+  
+  if (!running){CORE.Events_Remove(&OLED_I2C_Refresh_Slice);}
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Refresh_IsIdle()
+* Description: true when the glass matches the framebuffer and none of it is
+* on the bus.
+*
+*******************************************************************************/
+bool OLED_I2C_Refresh_IsIdle(OLED_Device_t *oled)
+{
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+  if ((OLED_Refresh_Transaction.status == I2C_Busy) && (OLED_Refresh_Sending == oled)){return false;}
+#endif
+  if (oled->run_remaining > 0){return false;}
+  
+  for (uint8_t page = 0; page < _OLED_PAGES; page++) {
+    if (OLED_I2C_Page_Dirty(oled, page)){return false;}
+    }
+  return true;
+}
+
+/******************************************************************************
+* Function : OLED_I2C_Refresh_Slice()
+* Description: Event callback - sends the next page write for the first
+* display, taking turns, that has one. Nothing dirty costs a check of the
+* page ranges and no bus traffic.
+*
+*******************************************************************************/
+void OLED_I2C_Refresh_Slice(void)
+{
+  OLED_Device_t *oled;
+  uint8_t length;
+  
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+  if (OLED_Refresh_Transaction.status == I2C_Busy){return;}  // Previous write still on the bus
+#else
+  uint8_t prefix[_OLED_PREFIX_MAX];
+  I2C1_Segment_t segments[2];
+#endif
+  
+  for (uint8_t tries = 0; tries < _OLED_REFRESH_MAX_DISPLAYS; tries++) {
+    oled = OLED_Refresh_List[OLED_Refresh_Next];
+    if (++OLED_Refresh_Next >= _OLED_REFRESH_MAX_DISPLAYS){OLED_Refresh_Next = 0;}
+    if (oled == NULL){continue;}
+    
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+    length = OLED_I2C_Prepare(oled, OLED_Refresh_Buffer);
+    if (length == 0){continue;}
+    
+    // The page goes behind the prefix - the framebuffer can be drawn on while it is on the bus
+    for (uint8_t column = oled->run_first; column <= oled->run_last; column++){OLED_Refresh_Buffer[length++] = oled->frame[oled->run_page][column];}
+    
+    OLED_Refresh_Sending = oled;
+    OLED_Refresh_Transaction.address = oled->address;
+    OLED_Refresh_Transaction.write_data = OLED_Refresh_Buffer;
+    OLED_Refresh_Transaction.write_length = length;
+    OLED_Refresh_Transaction.read_length = 0;
+    OLED_Refresh_Transaction.callback = &OLED_I2C_Refresh_Done;
+    OLED_Refresh_Transaction.timeout_us = 0;
+#ifdef _CORE18F_HAL_I2C1_PRESENCE_ENABLE
+    if (I2C1_PRESENCE.IsMissing(oled->address)){OLED_I2C_Sent(oled, false); return;}  // Cache only - no blocking probe next to the async queue
+#endif
+    if (I2C1_ASYNC.Submit(&OLED_Refresh_Transaction) != I2C_OK){OLED_I2C_Sent(oled, false);}  // Queue full - send it all again
+#else
+    length = OLED_I2C_Prepare(oled, prefix);
+    if (length == 0){continue;}
+    
+    segments[0].data = prefix;
+    segments[0].length = length;
+    segments[1].data = &oled->frame[oled->run_page][oled->run_first];
+    segments[1].length = (uint8_t)(oled->run_last - oled->run_first + 1);
+    OLED_I2C_Sent(oled, (OLED_I2C_Bus_Write(oled, segments, 2) == OLED_OK));
+#endif
+    return;
+    }
+}
+
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+/******************************************************************************
+* Function : OLED_I2C_Refresh_Done()
+* Description: Write completion - runs from I2C1_ASYNC.Service(). Moves the
+* run on and chains the next write straight away so a full redraw is not
+* paced by the event interval.
+*
+*******************************************************************************/
+void OLED_I2C_Refresh_Done(I2C1_Transaction_t *transaction)
+{
+#ifdef _CORE18F_HAL_I2C1_PRESENCE_ENABLE
+  if (transaction->status != I2C_OK){I2C1_PRESENCE.Invalidate(transaction->address);}
+#endif
+  OLED_I2C_Sent(OLED_Refresh_Sending, (transaction->status == I2C_OK));
+  OLED_I2C_Refresh_Slice();
+}
+#endif
+#endif
+
+
+
+/*** End of File **************************************************************/
@@ -0,0 +1,211 @@
+/****************************************************************************
+* Title                 :   OLED I2C Driver - SSD1306 / SH1106
+* Filename              :   oled_i2c.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+#ifndef _CORE18F_OLED_I2C_H
+#define _CORE18F_OLED_I2C_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core18F.h"
+
+#ifndef _CORE18F_HAL_I2C_ENABLE
+    #error "The OLED driver runs on I2C1 - define _CORE18F_HAL_I2C_ENABLE"
+#endif
+
+/******************************************************************************
+* 128x64 (or 128x32) monochrome OLEDs on I2C1 - SSD1306 and SH1106.
+*
+* Drawing is done in a framebuffer - one byte per column per 8 pixel page, the
+* controller's own layout, 1KB at 128x64. Every drawing call only changes the
+* framebuffer and widens the dirty column range of the pages it actually
+* changed. OLED.Flush() sends the dirty ranges and nothing else.
+*
+* SSD1306 - runs of dirty pages share one horizontal addressing window (the
+* union of their column ranges), set once by commands at the front of the
+* first page's write. The controller wraps from page to page by itself, so
+* the rest of the run is data only - one I2C write per page.
+* SH1106 - has no horizontal addressing, every dirty page is its own write
+* with its page and column set at the front.
+*
+* Text is a 5x7 font on 6 pixel columns, one text row per page - 21 x 8
+* characters at 128x64. Characters 0x20-0x7E are ASCII, 0x7F is a degree
+* sign, anything else draws a space.
+*******************************************************************************/
+
+/******************************************************************************
+* Configuration
+*******************************************************************************/
+#define _OLED_WIDTH 128
+#define _OLED_HEIGHT 64                    //64 or 32
+#define _OLED_PAGES (_OLED_HEIGHT / 8)
+#define _OLED_CONTRAST 0xCF                //Set by Initialize
+#define _OLED_POWER_UP_DELAY_MS 100        //VCC settling before the first command
+#define _OLED_SH1106_COLUMN_OFFSET 2       //SH1106 RAM is 132 columns, the glass shows 2-129
+
+#if (_OLED_HEIGHT == 64)
+    #define _OLED_COM_PINS 0x12            //Alternative COM pin layout
+#elif (_OLED_HEIGHT == 32)
+    #define _OLED_COM_PINS 0x02            //Sequential COM pin layout
+#else
+    #error "_OLED_HEIGHT must be 64 or 32"
+#endif
+
+/******************************************************************************
+* Background Refresh
+*
+* OLED.Refresh_Start() registers a slice with the event system. Every
+* _OLED_REFRESH_INTERVAL_MS the slice sends the next dirty page write and
+* returns - about 3.5ms of bus time for a full page at 400kHz.
+*
+* With the I2C1 async engine enabled the write is submitted as a transaction
+* and the next one is chained from its completion, a full redraw streams
+* out back to back without the main loop waiting on the bus.
+* I2C1_ASYNC.Initialize() must have been called.
+*
+* While the refresh runs OLED.Flush() must not be used on that display, and
+* the blocking calls (Initialize, Display, Contrast) only when
+* I2C1_ASYNC.IsIdle().
+*******************************************************************************/
+//#define _OLED_BACKGROUND_REFRESH_ENABLE
+#define _OLED_REFRESH_INTERVAL_MS 5
+#define _OLED_REFRESH_MAX_DISPLAYS 2
+
+#if defined(_OLED_BACKGROUND_REFRESH_ENABLE) && !defined(_CORE18F_SYSTEM_EVENTS_ENABLE)
+    #error "OLED background refresh runs from the event system - enable the system events"
+#endif
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+/*Control byte - first byte of every write*/
+#define _OLED_CONTROL_COMMANDS 0x00        //Co = 0, D/C = 0 - the rest of the write is commands
+#define _OLED_CONTROL_COMMAND 0x80         //Co = 1, D/C = 0 - one command, then another control byte
+#define _OLED_CONTROL_DATA 0x40            //Co = 0, D/C = 1 - the rest of the write is display data
+
+#define _OLED_CMD_SET_CONTRAST 0x81
+#define _OLED_CMD_DISPLAY_OFF 0xAE
+#define _OLED_CMD_DISPLAY_ON 0xAF
+#define _OLED_CMD_COLUMN_RANGE 0x21        //SSD1306 horizontal addressing - first, last column
+#define _OLED_CMD_PAGE_RANGE 0x22          //SSD1306 horizontal addressing - first, last page
+#define _OLED_CMD_SET_PAGE 0xB0            //SH1106 page addressing - | page
+#define _OLED_CMD_COLUMN_LOW 0x00          //SH1106 page addressing - | low nibble
+#define _OLED_CMD_COLUMN_HIGH 0x10         //SH1106 page addressing - | high nibble
+
+#define _OLED_PREFIX_MAX 13                //6 commands with their control bytes and the data control byte
+
+#define _OLED_FONT_FIRST 0x20
+#define _OLED_FONT_LAST 0x7F
+#define _OLED_FONT_WIDTH 5
+#define _OLED_CHAR_WIDTH 6                 //Font plus one blank column
+
+/*Displays - the address is 7-bit, 0x3C or 0x3D*/
+#define OLED_I2C_SSD1306(address) {address, OLED_CONTROLLER_SSD1306}
+#define OLED_I2C_SH1106(address) {address, OLED_CONTROLLER_SH1106}
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+ OLED_OK,
+ OLED_GENERIC_ERROR
+}OLED_Status_Enum_t;
+
+typedef enum
+{
+ OLED_CONTROLLER_SSD1306,
+ OLED_CONTROLLER_SH1106
+}OLED_Controller_Enum_t;
+
+/*One per display, owned by the application - declare with OLED_I2C_SSD1306()
+ *or OLED_I2C_SH1106(), the rest is set up by Initialize.*/
+typedef struct
+{
+  uint8_t address;
+  OLED_Controller_Enum_t controller;
+  uint8_t frame[_OLED_PAGES][_OLED_WIDTH];
+  uint8_t dirty_first[_OLED_PAGES];        //Changed columns of each page - clean when first > last
+  uint8_t dirty_last[_OLED_PAGES];
+  uint8_t run_page;                        //Next page of the run being sent
+  uint8_t run_remaining;                   //Pages of the run still to send, 0 - no run
+  uint8_t run_first;                       //Column window of the run
+  uint8_t run_last;
+}OLED_Device_t;
+
+/******************************************************************************
+***** OLED Interface
+*******************************************************************************/
+typedef struct {
+  OLED_Status_Enum_t (*Initialize)(OLED_Device_t *oled);
+  OLED_Status_Enum_t (*Display)(OLED_Device_t *oled, LogicEnum_t set_display);
+  OLED_Status_Enum_t (*Contrast)(OLED_Device_t *oled, uint8_t level);
+  void (*Clear)(OLED_Device_t *oled);
+  OLED_Status_Enum_t (*Pixel)(OLED_Device_t *oled, uint8_t x, uint8_t y, LogicEnum_t set_pixel);
+  OLED_Status_Enum_t (*Write_Character)(OLED_Device_t *oled, uint8_t row, uint8_t column, uint8_t character);
+  OLED_Status_Enum_t (*Write)(OLED_Device_t *oled, uint8_t row, uint8_t column, char *StringData);
+  OLED_Status_Enum_t (*Flush)(OLED_Device_t *oled);
+  #ifdef _OLED_BACKGROUND_REFRESH_ENABLE
+    OLED_Status_Enum_t (*Refresh_Start)(OLED_Device_t *oled);
+    void (*Refresh_Stop)(OLED_Device_t *oled);
+    bool (*Refresh_IsIdle)(OLED_Device_t *oled);
+  #endif
+}OLED_Interface_t;
+
+extern const OLED_Interface_t OLED;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+OLED_Status_Enum_t OLED_I2C_Init(OLED_Device_t *oled);
+OLED_Status_Enum_t OLED_I2C_Display(OLED_Device_t *oled, LogicEnum_t set_display);
+OLED_Status_Enum_t OLED_I2C_Contrast(OLED_Device_t *oled, uint8_t level);
+void OLED_I2C_Clear(OLED_Device_t *oled);
+OLED_Status_Enum_t OLED_I2C_Pixel(OLED_Device_t *oled, uint8_t x, uint8_t y, LogicEnum_t set_pixel);
+OLED_Status_Enum_t OLED_I2C_Write_Character(OLED_Device_t *oled, uint8_t row, uint8_t column, uint8_t character);
+OLED_Status_Enum_t OLED_I2C_Write_String(OLED_Device_t *oled, uint8_t row, uint8_t column, char *StringData);
+OLED_Status_Enum_t OLED_I2C_Flush(OLED_Device_t *oled);
+#ifdef _OLED_BACKGROUND_REFRESH_ENABLE
+OLED_Status_Enum_t OLED_I2C_Refresh_Start(OLED_Device_t *oled);
+void OLED_I2C_Refresh_Stop(OLED_Device_t *oled);
+bool OLED_I2C_Refresh_IsIdle(OLED_Device_t *oled);
+#endif
+
+#endif /*_CORE18F_OLED_I2C_H*/
+
+/*** End of File **************************************************************/
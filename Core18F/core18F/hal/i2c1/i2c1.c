@@ -33,6 +33,11 @@
 *
 *   Date        Version     Author          Description 
 *   2024/08/15  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  ReadData - Repeated start burst reads, system timer timeouts
+*   2026/10/18  1.2.0       Jamie Starling  Bus speed and SDA hold computed from _I2C1_BUS_SPEED_HZ
+*   2026/10/18  1.3.0       Jamie Starling  WriteVector - scatter-gather writes, WriteData is a single segment
+*   2026/10/18  1.4.0       Jamie Starling  Bus recovery replaces the 25ms reset delay, recovery statistics
+*   2026/10/18  1.5.0       Jamie Starling  Microsecond timeouts set per transaction, NACK/timeout/collision statistics
 *  
 *
 *****************************************************************************/
@@ -50,12 +55,25 @@ const I2C1_Master_Interface_t I2C1_MASTER = {
   .BusReset = &MASTER_I2C1_Reset,
   .WriteData = &MASTER_I2C1_WriteData,
   .ReadData = &MASTER_I2C1_ReadData,  
+  .WriteVector = &MASTER_I2C1_WriteVector,
+  .SetTimeout = &MASTER_I2C1_SetTimeout,
+  .GetStats = &MASTER_I2C1_GetStats,
+  .ClearStats = &MASTER_I2C1_ClearStats,
   };
 
+/******************************************************************************
+* Variables
+*******************************************************************************/
+I2C1_Stats_t I2C1_Stats;
+uint16_t I2C1_Timeout_US = _I2C1_DEFAULT_TIMEOUT_US;
+
 /******************************************************************************
 * Function Prototypes
 *******************************************************************************/
+void I2C1_Bus_Recover(void);
 I2C1_Status_Enum_t I2C1_Wait_Until_Complete(void);
+I2C1_Status_Enum_t I2C1_Wait_For_Flag(volatile uint8_t *flag_register, uint8_t flag_mask);
+void I2C1_Clear_Interrupts(void);
 void MASTER_I2C1_Send_Stop(void);
 /******************************************************************************
 * Functions
@@ -71,41 +89,51 @@ void MASTER_I2C1_Send_Stop(void);
 *******************************************************************************/
 void MASTER_I2C1_Init(void)
 {
-    GPIO.ModeSet(I2C1_CLOCK_PIN,OPEN_DRAIN);
-    GPIO.ModeSet(I2C1_DATA_PIN,OPEN_DRAIN);  
-    GPIO.PinWrite(I2C1_CLOCK_PIN,HIGH);
-    GPIO.PinWrite(I2C1_DATA_PIN,HIGH);    
- 
-    PPS_MapBiDirection(I2C1_CLOCK_PIN,PPSOUT_I2C1_SCL,&I2C1SCLPPS);
-    PPS_MapBiDirection(I2C1_DATA_PIN,PPSOUT_I2C1_SDA,&I2C1SDAPPS); 
+    I2C1_Map_Pins();
     
     I2C1CON0 = 0x4; //I2C Host mode, 7-bit address 
     I2C1CON1 = 0x80; //ACKCNT Not Acknowledge;     
-    I2C1CON2bits.SDAHT = 0b10; //SDAHT 30 ns hold time;
+    I2C1CON2bits.SDAHT = _I2C1_SDA_HOLD; //SDA hold time for the bus speed
     I2C1CON2bits.ABD = 0; //Address Buffer 
   
-    I2C1CLK = 0x0; //CLK Fosc/4
+    I2C1CLK = _I2C1_CLOCK_SOURCE; //Fosc/4, Fosc for Fast-mode Plus
     I2C1PIR = 0x0; //Clear Interrupt Flags  
     I2C1PIE = 0x0; //Disable all I2C1 Interrupts  
     I2C1ERR = 0x0; //Clear All Errors
     /* Clear Byte Count registers */
     I2C1CNTL = 0x0;
     I2C1CNTH = 0x0;  
-    I2C1BAUD = 0x1F; // Set BAUD 31 - 100Khz
+    I2C1BAUD = _I2C1_BAUD_VALUE; //Computed from _I2C1_BUS_SPEED_HZ
    
     I2C1BTOC = 0x0; /* BTOC TMR2 post scaled output;  */     
   MASTER_I2C1_Reset();
 }
 
 
+/******************************************************************************
+* Function : I2C1_Map_Pins()
+* Description: Open drain pins released high, SCL and SDA mapped to the I2C1 module.
+*
+*******************************************************************************/
+void I2C1_Map_Pins(void)
+{
+    GPIO.ModeSet(I2C1_CLOCK_PIN,OPEN_DRAIN);
+    GPIO.ModeSet(I2C1_DATA_PIN,OPEN_DRAIN);  
+    GPIO.PinWrite(I2C1_CLOCK_PIN,HIGH);
+    GPIO.PinWrite(I2C1_DATA_PIN,HIGH);    
+ 
+    PPS_MapBiDirection(I2C1_CLOCK_PIN,PPSOUT_I2C1_SCL,&I2C1SCLPPS);
+    PPS_MapBiDirection(I2C1_DATA_PIN,PPSOUT_I2C1_SDA,&I2C1SDAPPS); 
+}
+
 /******************************************************************************
 * Function : MASTER_I2C1_Reset()
 * Description: This function resets the I2C1 module in master mode. It disables the I2C1 module, 
-* clears any overflows or write collisions, and flushes the buffer. It also clears 
-* the MSSP1 interrupt flag to ensure the I2C bus is reset to a known state.
+* clears any overflows or write collisions, and flushes the buffer. The bus is
+* then checked and recovered if a target is holding SDA low.
 *
 * After performing these actions, the function re-enables the I2C1 module to allow 
-* it to resume normal operation.
+* it to resume normal operation. An idle bus costs a few microseconds.
 *
 *******************************************************************************/
 void MASTER_I2C1_Reset(void)
@@ -114,10 +142,114 @@ void MASTER_I2C1_Reset(void)
     I2C1STAT1bits.CLRBF = 1; //Clears Buffers
     I2C1STAT1bits.TXWE = 0; //Clear Transmit Write Error
     I2C1STAT1bits.RXRE = 0; //Clear Receive Write Error  
-    __delay_ms(25);
+    I2C1_Bus_Recover();
     I2C1CON0bits.EN = 1; //Enable I2C
 }
 
+/******************************************************************************
+* Function : I2C1_Bus_Recover()
+* Description: Takes the pins back from the module and checks the bus. A target
+* reset part way through a read can hold SDA low waiting for clocks - SCL is
+* clocked by hand until it lets go (9 clocks at most), then a Stop is sent.
+* The pins are mapped back to the module when done.
+*
+*******************************************************************************/
+void I2C1_Bus_Recover(void)
+{
+    /*Pins follow LAT - open drain, so HIGH releases the line*/
+    *(GPIO_Register_LU[I2C1_CLOCK_PIN].pps_output_reg) = PSSOUT_LATxy;
+    *(GPIO_Register_LU[I2C1_DATA_PIN].pps_output_reg) = PSSOUT_LATxy;
+    GPIO.PinWrite(I2C1_CLOCK_PIN,HIGH);
+    GPIO.PinWrite(I2C1_DATA_PIN,HIGH);
+    __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+    
+    if ((GPIO.PinRead(I2C1_DATA_PIN) == LOW) || (GPIO.PinRead(I2C1_CLOCK_PIN) == LOW)) {
+        for (uint8_t clock = 0; (clock < _I2C1_RECOVERY_CLOCKS) && (GPIO.PinRead(I2C1_DATA_PIN) == LOW); clock++) {
+            GPIO.PinWrite(I2C1_CLOCK_PIN,LOW);
+            __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+            GPIO.PinWrite(I2C1_CLOCK_PIN,HIGH);
+            __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+        }
+        
+        /*Stop - SDA rises while SCL is high*/
+        GPIO.PinWrite(I2C1_CLOCK_PIN,LOW);
+        GPIO.PinWrite(I2C1_DATA_PIN,LOW);
+        __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+        GPIO.PinWrite(I2C1_CLOCK_PIN,HIGH);
+        __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+        GPIO.PinWrite(I2C1_DATA_PIN,HIGH);
+        __delay_us(_I2C1_RECOVERY_HALF_PERIOD_US);
+        
+        if ((GPIO.PinRead(I2C1_DATA_PIN) == HIGH) && (GPIO.PinRead(I2C1_CLOCK_PIN) == HIGH)){I2C1_Stats.recoveries++;}
+        else {I2C1_Stats.recovery_failures++;}
+    }
+    
+    I2C1_Map_Pins();
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_SetTimeout()
+* Description: Sets how long a transfer may wait for the bus to move on before
+* giving up with I2C_TIMEOUT. Applies to the calls that follow - set it before
+* a transaction with a slow, clock stretching target and put it back after.
+*
+* Parameters:
+*   - timeout_us (uint16_t): Timeout in microseconds, 4us resolution.
+*******************************************************************************/
+void MASTER_I2C1_SetTimeout(uint16_t timeout_us)
+{
+    I2C1_Timeout_US = timeout_us;
+}
+
+/******************************************************************************
+* Function : I2C1_Record_Status()
+* Description: Counts failed transfers by cause and hands the status back, so
+* return paths can be wrapped in it.
+*
+*******************************************************************************/
+I2C1_Status_Enum_t I2C1_Record_Status(I2C1_Status_Enum_t status)
+{
+    switch (status) {
+        case I2C_ADDRESS_INVALID: I2C1_Stats.address_nacks++; break;
+        case I2C_NACK_RECEIVED: I2C1_Stats.nacks++; break;
+        case I2C_TIMEOUT: I2C1_Stats.timeouts++; break;
+        case I2C_BUS_COLLISION: I2C1_Stats.collisions++; break;
+        default: break;
+    }
+    return status;
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_GetStats()
+* Description: Copies the bus statistics. The counters wrap - clear them after
+* reading to measure over an interval.
+*
+* Parameters:
+*   - stats (I2C1_Stats_t*): Filled with the current counters.
+*******************************************************************************/
+void MASTER_I2C1_GetStats(I2C1_Stats_t *stats)
+{
+    uint8_t gie_state = INTCON0bits.GIE;   //Restored, not forced on - safe inside a critical section
+    
+    INTCON0bits.GIE = 0;   //The async engine counts from its ISR
+    *stats = I2C1_Stats;
+    INTCON0bits.GIE = gie_state;
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_ClearStats()
+* 
+*******************************************************************************/
+void MASTER_I2C1_ClearStats(void)
+{
+    I2C1_Stats.address_nacks = 0;
+    I2C1_Stats.nacks = 0;
+    I2C1_Stats.timeouts = 0;
+    I2C1_Stats.collisions = 0;
+    I2C1_Stats.recoveries = 0;
+    I2C1_Stats.recovery_failures = 0;
+}
+
 /******************************************************************************
 * Function : MASTER_I2C1_WriteData()
 * Description: Writes a block of data to a specified I2C address. Sends the start condition,
@@ -135,39 +267,68 @@ void MASTER_I2C1_Reset(void)
 *******************************************************************************/
 I2C1_Status_Enum_t MASTER_I2C1_WriteData(uint8_t i2c_address,uint8_t i2c_bytecount, uint8_t *datablock)
 {
-  uint8_t i2c_count_compare;
-  I2C1CNTL = i2c_bytecount;  //Load the data byte count 
+  I2C1_Segment_t segment = {datablock, i2c_bytecount};
+  
+  return MASTER_I2C1_WriteVector(i2c_address, &segment, 1);
+}
+
+/******************************************************************************
+* Function : MASTER_I2C1_WriteVector()
+* Description: Writes a list of segments to a specified I2C address as one
+* transaction. The byte counter is loaded with the total of all segments, so
+* the module frames it as a single Start...Stop and software only feeds I2C1TXB.
+* A register address and its payload can be sent from separate buffers without
+* copying them together first.
+*
+* Parameters:
+*   - i2c_address (uint8_t): The I2C address of the device to write to.
+*   - segments (const I2C1_Segment_t*): Segments in the order they go on the bus.
+*   - segment_count (uint8_t): Number of segments, empty segments are skipped.
+*
+* Returns:
+*   - I2C1_Status_Enum_t: I2C_OK, I2C_ADDRESS_INVALID, I2C_NACK_RECEIVED or I2C_TIMEOUT.
+*
+* Example:
+*   uint8_t reg = 0x40;
+*   I2C1_Segment_t write[2] = {{&reg, 1}, {settings, sizeof(settings)}};
+*   I2C1_MASTER.WriteVector(0x20, write, 2);
+*******************************************************************************/
+I2C1_Status_Enum_t MASTER_I2C1_WriteVector(uint8_t i2c_address, const I2C1_Segment_t *segments, uint8_t segment_count)
+{
+  I2C1_Status_Enum_t status = I2C_OK;
+  uint16_t total_bytes = 0;
+  bool start_sent = false;
+  
+  for (uint8_t segment = 0; segment < segment_count; segment++){total_bytes += segments[segment].length;}
+  
+  I2C1_Clear_Interrupts();   //CNTIF from the last transfer would end the wait early
+  I2C1CON0bits.RSEN = CLEAR; //Stop when the count reaches zero
+  I2C1CNTH = (uint8_t)(total_bytes >> 8);  //Load the data byte count
+  I2C1CNTL = (uint8_t)total_bytes;
   I2C1ADB1 = (uint8_t)(i2c_address << 1);   //Load the Address Register 
-  if (!(i2c_bytecount == 0)){I2C1TXB = datablock[0];} 
   
-  I2C1CON0bits.S = SET; //Set the Start Bit  
+  /*First byte is loaded before the Start, the rest as I2C1TXB empties*/
+  for (uint8_t segment = 0; (segment < segment_count) && (status == I2C_OK); segment++) {
+      for (uint8_t i = 0; (i < segments[segment].length) && (status == I2C_OK); i++) {
+          if (start_sent){status = I2C1_Wait_For_Flag(&PIR7, _PIR7_I2C1TXIF_MASK);}
+          if (status == I2C_OK){I2C1TXB = segments[segment].data[i];}
+          if (!start_sent) {
+              I2C1CON0bits.S = SET;
+              start_sent = true;
+          }
+      }
+  }
   
-  //No data - used for address check
-  if (i2c_bytecount == 0){    
-    //while(!I2C1PIRbits.CNTIF){}  //Wait for completion
-    if (I2C1_Wait_Until_Complete() == I2C_TIMEOUT){
-        MASTER_I2C1_Send_Stop();
-        return I2C_TIMEOUT;
-    }  
-    if(I2C1CON1bits.ACKSTAT){return I2C_ADDRESS_INVALID;} //Check for ACK on address  
-    return I2C_OK;
-    }
+  if (!start_sent){I2C1CON0bits.S = SET;}  //No data - used for address check
   
-  for (uint8_t i2c_bytecounter = 1; i2c_bytecounter < i2c_bytecount; i2c_bytecounter++){    
-    while (!PIR7bits.I2C1TXIF){}
-    i2c_count_compare = I2C1CNTL;
-    I2C1TXB = datablock[i2c_bytecounter];   
-    while(I2C1CNTL == i2c_count_compare && I2C1STAT0bits.MMA){return I2C_NACK_RECEIVED;}    
-    }
+  if (status == I2C_OK){status = I2C1_Wait_Until_Complete();}
+  if (status != I2C_OK) {
+      MASTER_I2C1_Send_Stop();
+      return I2C1_Record_Status(((status == I2C_NACK_RECEIVED) && (CORE_Make_16(I2C1CNTH, I2C1CNTL) == total_bytes)) ? I2C_ADDRESS_INVALID : status);
+  }
   
-  //while(!I2C1PIRbits.CNTIF){}  //Wait for completion  
-  if (I2C1_Wait_Until_Complete() == I2C_TIMEOUT){
-        MASTER_I2C1_Send_Stop();
-        return I2C_TIMEOUT;
-    }  
-  if(I2C1CON1bits.ACKSTAT){return I2C_NACK_RECEIVED;} //Check for ACK  
+  if(I2C1CON1bits.ACKSTAT){return I2C1_Record_Status((total_bytes == 0) ? I2C_ADDRESS_INVALID : I2C_NACK_RECEIVED);} //Check for ACK  
   return I2C_OK;
-    
 }
 
 /******************************************************************************
@@ -177,16 +338,78 @@ I2C1_Status_Enum_t MASTER_I2C1_WriteData(uint8_t i2c_address,uint8_t i2c_bytecou
 void I2C1_Clear_Interrupts(void)
 {
   I2C1PIR = 0;
+  I2C1ERRbits.NACKIF = 0;
+  I2C1ERRbits.BCLIF = 0;
   I2C1STAT1bits.CLRBF = 1;
 }
 
 /******************************************************************************
 * Function : MASTER_I2C1_ReadData()
-* 
+* Description: Writes the send block (usually a register address), then reads
+* the receive block after a repeated start, in one transaction. The byte counter
+* runs both phases - the module ACKs each received byte and NACKs the last one
+* itself, software only moves bytes out of I2C1RXB.
+*
+* Parameters:
+*   - i2c_address (uint8_t): The 7-bit I2C address of the device.
+*   - i2c_bytecount_send (uint8_t): Bytes to write first, 0 for a plain read.
+*   - datablock_send (uint8_t*): Data to write.
+*   - i2c_bytecount_receive (uint8_t): Bytes to read.
+*   - datablock_receive (uint8_t*): Buffer for the data read.
+*
+* Returns:
+*   - I2C1_Status_Enum_t: I2C_OK, I2C_ADDRESS_INVALID, I2C_NACK_RECEIVED or I2C_TIMEOUT.
+*
+* Example:
+*   uint8_t reg = 0x00;
+*   uint8_t reading[6];
+*   I2C1_MASTER.ReadData(0x68, 1, &reg, 6, reading);
 *******************************************************************************/
 I2C1_Status_Enum_t MASTER_I2C1_ReadData(uint8_t i2c_address,uint8_t i2c_bytecount_send, uint8_t *datablock_send, uint8_t i2c_bytecount_receive, uint8_t *datablock_receive)
 {
-  return 0;
+  I2C1_Status_Enum_t status = I2C_OK;
+  
+  if (i2c_bytecount_receive == 0){return MASTER_I2C1_WriteData(i2c_address, i2c_bytecount_send, datablock_send);}
+  
+  I2C1_Clear_Interrupts();
+  
+  /*Write phase - RSEN holds the bus when the count reaches zero*/
+  if (i2c_bytecount_send > 0) {
+      I2C1CON0bits.RSEN = SET;
+      I2C1CNTL = i2c_bytecount_send;
+      I2C1ADB1 = (uint8_t)(i2c_address << 1);
+      I2C1TXB = datablock_send[0];
+      I2C1CON0bits.S = SET;
+      
+      for (uint8_t i = 1; (i < i2c_bytecount_send) && (status == I2C_OK); i++) {
+          status = I2C1_Wait_For_Flag(&PIR7, _PIR7_I2C1TXIF_MASK);
+          if (status == I2C_OK){I2C1TXB = datablock_send[i];}
+      }
+      if (status == I2C_OK){status = I2C1_Wait_Until_Complete();}
+      if (status != I2C_OK) {
+          I2C1CON0bits.RSEN = CLEAR;
+          MASTER_I2C1_Send_Stop();
+          return I2C1_Record_Status(((status == I2C_NACK_RECEIVED) && (I2C1CNTL == i2c_bytecount_send)) ? I2C_ADDRESS_INVALID : status);
+      }
+      I2C1PIRbits.CNTIF = CLEAR;
+  }
+  
+  /*Read phase - started as a repeated start if there was a write phase*/
+  I2C1CON0bits.RSEN = CLEAR;  //Stop after the last byte
+  I2C1CNTL = i2c_bytecount_receive;
+  I2C1ADB1 = (uint8_t)((i2c_address << 1) | 0x01);
+  I2C1CON0bits.S = SET;
+  
+  for (uint8_t i = 0; i < i2c_bytecount_receive; i++) {
+      status = I2C1_Wait_For_Flag(&PIR7, _PIR7_I2C1RXIF_MASK);
+      if (status != I2C_OK) {
+          MASTER_I2C1_Send_Stop();
+          return I2C1_Record_Status(((status == I2C_NACK_RECEIVED) && (i == 0)) ? I2C_ADDRESS_INVALID : status);
+      }
+      datablock_receive[i] = I2C1RXB;
+  }
+  
+  return I2C1_Record_Status(I2C1_Wait_For_Flag(&I2C1PIR, _I2C1PIR_PCIF_MASK));  //Stop sent - bus free for the next call
 }
 
 /******************************************************************************
@@ -200,10 +423,32 @@ I2C1_Status_Enum_t MASTER_I2C1_ReadData(uint8_t i2c_address,uint8_t i2c_bytecoun
 *******************************************************************************/
 I2C1_Status_Enum_t I2C1_Wait_Until_Complete(void)
 {
-  uint8_t timeout_counter = _I2C1_BUS_TIMEOUT_VALUE; 
+  return I2C1_Wait_For_Flag(&I2C1PIR, _I2C1PIR_CNTIF_MASK);
+}
+
+/******************************************************************************
+* Function : I2C1_Wait_For_Flag()
+* Description: Waits for a flag bit to set, giving up when the bus has not moved
+* on for the timeout (system timer microseconds), the target NACKs or the bus
+* collides.
+*
+* Parameters:
+*   - flag_register (volatile uint8_t*): Register holding the flag.
+*   - flag_mask (uint8_t): Flag bit mask.
+*
+* Returns:
+*   - I2C1_Status_Enum_t: I2C_OK, I2C_NACK_RECEIVED, I2C_BUS_COLLISION or I2C_TIMEOUT.
+*******************************************************************************/
+I2C1_Status_Enum_t I2C1_Wait_For_Flag(volatile uint8_t *flag_register, uint8_t flag_mask)
+{
+  uint32_t start_time = ISR_CORE18F_SYSTEM_TIMER_GetMicros();
   
-  while (!I2C1PIRbits.CNTIF && timeout_counter-- > 0){} //wait until complete or time out    
-  return (timeout_counter == 0) ? I2C_TIMEOUT : I2C_OK;
+  while (!(*flag_register & flag_mask)) {
+      if (I2C1ERRbits.NACKIF){return I2C_NACK_RECEIVED;}
+      if (I2C1ERRbits.BCLIF){return I2C_BUS_COLLISION;}
+      if ((ISR_CORE18F_SYSTEM_TIMER_GetMicros() - start_time) > I2C1_Timeout_US){return I2C_TIMEOUT;}
+  }
+  return I2C_OK;
 }
 
 /******************************************************************************
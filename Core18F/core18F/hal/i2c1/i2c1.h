@@ -33,6 +33,12 @@
 *
 *   Date        Version     Author          Description 
 *   2024/08/15  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  ReadData - Repeated start burst reads, system timer timeouts
+*   2026/10/18  1.2.0       Jamie Starling  I2C_BUS_COLLISION status for the async engine
+*   2026/10/18  1.3.0       Jamie Starling  Bus speed from _I2C1_BUS_SPEED_HZ
+*   2026/10/18  1.4.0       Jamie Starling  WriteVector - scatter-gather writes
+*   2026/10/18  1.5.0       Jamie Starling  Bus recovery replaces the reset delay, recovery statistics
+*   2026/10/18  1.6.0       Jamie Starling  Microsecond timeouts, NACK/timeout/collision statistics
 *  
 *****************************************************************************/
 
@@ -43,11 +49,50 @@
 *******************************************************************************/
 #include "../../core18F.h"
 
+#ifndef _CORE18F_SYSTEM_TIMER_ENABLE
+    #error "I2C1 timeouts use the system timer - define _CORE18F_SYSTEM_TIMER_ENABLE"
+#endif
+
 /******************************************************************************
 ****** Configuration
 *******************************************************************************/
-#define _I2C1_BUS_TIMEOUT_VALUE 250
-#define _I2C1_RESET_DELAY_MS 25
+#define _I2C1_DEFAULT_TIMEOUT_US 2000   //Longest wait for the bus to move on - covers clock stretching
+#define _I2C1_RECOVERY_CLOCKS 9            //Enough for a target stuck anywhere in a byte plus ACK
+#define _I2C1_RECOVERY_HALF_PERIOD_US 5     //100kHz recovery clock
+
+/******************************************************************************
+****** Bus Speed - from _I2C1_BUS_SPEED_HZ in the device config
+* SCL = I2C clock / (5 * (BAUD + 1)). Fosc/4 covers Standard and Fast-mode,
+* Fast-mode Plus uses Fosc for a finer divider. The divider is rounded up so
+* the bus never runs faster than asked.
+*******************************************************************************/
+#ifndef _I2C1_BUS_SPEED_HZ
+    #define _I2C1_BUS_SPEED_HZ 100000UL
+#endif
+
+#if (_I2C1_BUS_SPEED_HZ > 1000000UL)
+    #error "I2C1 bus speed above Fast-mode Plus (1MHz)"
+#elif (_I2C1_BUS_SPEED_HZ > 400000UL)
+    #define _I2C1_CLOCK_SOURCE 0x1      //Fosc
+    #define _I2C1_CLOCK_HZ _XTAL_FREQ
+    #define _I2C1_SDA_HOLD 0b10         //30ns - Fast-mode Plus data valid time
+#elif (_I2C1_BUS_SPEED_HZ > 100000UL)
+    #define _I2C1_CLOCK_SOURCE 0x0      //Fosc/4
+    #define _I2C1_CLOCK_HZ (_XTAL_FREQ / 4)
+    #define _I2C1_SDA_HOLD 0b01         //100ns minimum hold on the Q84
+#else
+    #define _I2C1_CLOCK_SOURCE 0x0      //Fosc/4
+    #define _I2C1_CLOCK_HZ (_XTAL_FREQ / 4)
+    #define _I2C1_SDA_HOLD 0b00         //300ns
+#endif
+
+#define _I2C1_BAUD_DIVIDER ((_I2C1_CLOCK_HZ + (5UL * _I2C1_BUS_SPEED_HZ) - 1) / (5UL * _I2C1_BUS_SPEED_HZ))
+
+#if (_I2C1_BAUD_DIVIDER > 256)
+    #error "I2C1 bus speed too low for _XTAL_FREQ - BAUD is 8 bits"
+#endif
+
+#define _I2C1_BAUD_VALUE (_I2C1_BAUD_DIVIDER - 1)
 
 /******************************************************************************
 * I2C Return Codes
@@ -59,9 +104,32 @@ typedef enum
     I2C_ACK_RECEIVED,
     I2C_TIMEOUT,
     I2C_OK,
-    I2C_Busy
+    I2C_Busy,
+    I2C_BUS_COLLISION
 }I2C1_Status_Enum_t;
 
+/******************************************************************************
+* I2C Write Segment - one piece of a vectored write
+******************************************************************************/
+typedef struct
+{
+    const uint8_t *data;
+    uint8_t length;
+}I2C1_Segment_t;
+
+
+/******************************************************************************
+* I2C1 Bus Statistics
+******************************************************************************/
+typedef struct
+{
+    uint16_t address_nacks;         //No target answered the address
+    uint16_t nacks;                 //Target refused a data byte
+    uint16_t timeouts;
+    uint16_t collisions;            //Lost arbitration or the bus was driven under us
+    uint16_t recoveries;            //Bus found stuck and released
+    uint16_t recovery_failures;     //Still stuck after recovery - SCL held low or a shorted line
+}I2C1_Stats_t;
 
 /******************************************************************************
 ***** I2C1 Interface
@@ -71,6 +139,10 @@ typedef struct {
   void (*BusReset)(void); 
   I2C1_Status_Enum_t (*WriteData)(uint8_t i2c_address,uint8_t i2c_bytecount, uint8_t *datablock);
   I2C1_Status_Enum_t (*ReadData) (uint8_t i2c_address,uint8_t i2c_bytecount_send, uint8_t *datablock_send, uint8_t i2c_bytecount_receive, uint8_t *datablock_receive);
+  I2C1_Status_Enum_t (*WriteVector)(uint8_t i2c_address, const I2C1_Segment_t *segments, uint8_t segment_count);
+  void (*SetTimeout)(uint16_t timeout_us);
+  void (*GetStats)(I2C1_Stats_t *stats);
+  void (*ClearStats)(void);
 }I2C1_Master_Interface_t;
 
 extern const I2C1_Master_Interface_t I2C1_MASTER;
@@ -83,6 +155,12 @@ void MASTER_I2C1_Init(void);
 void MASTER_I2C1_Reset(void);
 I2C1_Status_Enum_t MASTER_I2C1_WriteData(uint8_t i2c_address,uint8_t i2c_bytecount, uint8_t *datablock);
 I2C1_Status_Enum_t MASTER_I2C1_ReadData(uint8_t i2c_address,uint8_t i2c_bytecount_send, uint8_t *datablock_send, uint8_t i2c_bytecount_receive, uint8_t *datablock_receive);
+I2C1_Status_Enum_t MASTER_I2C1_WriteVector(uint8_t i2c_address, const I2C1_Segment_t *segments, uint8_t segment_count);
+void MASTER_I2C1_SetTimeout(uint16_t timeout_us);
+void MASTER_I2C1_GetStats(I2C1_Stats_t *stats);
+void MASTER_I2C1_ClearStats(void);
+I2C1_Status_Enum_t I2C1_Record_Status(I2C1_Status_Enum_t status);
+void I2C1_Map_Pins(void);
 
 
 
@@ -0,0 +1,468 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Asynchronous Transaction Engine
+* Filename              :   i2c1_async.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.2.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  DMA mode - DMA1/DMA2 move the data, no CPU per byte
+*   2026/10/18  1.2.0       Jamie Starling  Per transaction timeouts, results counted in the I2C1 statistics
+*  
+*****************************************************************************/
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "i2c1_async.h"
+
+/******************************************************************************
+* I2C1 Async Interface
+*******************************************************************************/
+const I2C1_Async_Interface_t I2C1_ASYNC = {
+  .Initialize = &I2C1_ASYNC_Init,
+  .Submit = &I2C1_ASYNC_Submit,
+  .Service = &I2C1_ASYNC_Service,
+  .IsIdle = &I2C1_ASYNC_IsIdle,
+};
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  I2C1_ASYNC_PHASE_WRITE,
+  I2C1_ASYNC_PHASE_READ,
+  I2C1_ASYNC_PHASE_STOP
+}I2C1_Async_Phase_Enum_t;
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+/*Queue indexes - Head is moved by Submit, Active by the ISR and Tail by Service.
+ *Tail..Active are complete and waiting for their callback, Active..Head are waiting for the bus.*/
+I2C1_Transaction_t *I2C1_ASYNC_Queue[_I2C1_ASYNC_QUEUE_SIZE];
+volatile uint8_t I2C1_ASYNC_Head;
+volatile uint8_t I2C1_ASYNC_Active;
+volatile uint8_t I2C1_ASYNC_Tail;
+volatile bool I2C1_ASYNC_Running;
+volatile uint8_t I2C1_ASYNC_Sequence;   //Bumped by the ISR for each transaction started
+
+uint8_t I2C1_ASYNC_Watch_Sequence;      //Transaction being timed by Service
+uint32_t I2C1_ASYNC_Watch_Start;
+
+volatile I2C1_Async_Phase_Enum_t I2C1_ASYNC_Phase;
+volatile uint8_t I2C1_ASYNC_Index;
+volatile I2C1_Status_Enum_t I2C1_ASYNC_Result;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void I2C1_ASYNC_Start(I2C1_Transaction_t *transaction);
+void I2C1_ASYNC_Start_Read(I2C1_Transaction_t *transaction);
+void I2C1_ASYNC_Complete(void);
+void I2C1_ASYNC_Check_Timeout(void);
+#ifdef _CORE18F_I2C1_DMA_ENABLE
+void I2C1_DMA_Init(void);
+void I2C1_DMA_Start(uint8_t channel, volatile void *source, uint8_t source_size, volatile void *destination, uint8_t destination_size, uint8_t trigger);
+void I2C1_DMA_Stop(void);
+#endif
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : I2C1_ASYNC_Init()
+* Description: Initializes the I2C1 module, empties the transaction queue and
+* enables interrupts. With the event system enabled completions are delivered
+* from the event loop, otherwise call I2C1_ASYNC_Service() from the main loop.
+*
+* The blocking I2C1_MASTER functions must not be used while a transaction is
+* queued - check I2C1_ASYNC_IsIdle() first.
+*******************************************************************************/
+void I2C1_ASYNC_Init(void)
+{
+  MASTER_I2C1_Init();
+  
+  I2C1_ASYNC_Head = 0;
+  I2C1_ASYNC_Active = 0;
+  I2C1_ASYNC_Tail = 0;
+  I2C1_ASYNC_Running = false;
+  
+  #ifdef _CORE18F_I2C1_DMA_ENABLE
+    I2C1_DMA_Init();
+  #endif
+  
+  #ifdef _CORE18F_SYSTEM_EVENTS_ENABLE
+    ScheduleEvent(_I2C1_ASYNC_SERVICE_INTERVAL_MS, &I2C1_ASYNC_Service, _I2C1_ASYNC_SERVICE_INTERVAL_MS);
+  #endif
+  
+  ISR_Enable_System_Default();
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Submit()
+* Description: Queues a transaction and starts it if the bus is idle. Returns
+* straight away, the transaction status stays I2C_Busy until it completes.
+*
+* Parameters:
+*   - transaction (I2C1_Transaction_t*): Caller owned, must stay valid until
+*     the callback runs.
+*
+* Returns:
+*   - I2C1_Status_Enum_t: I2C_OK if queued, I2C_Busy if the queue is full.
+*
+* Example:
+*   uint8_t reg = 0x00;
+*   uint8_t reading[6];
+*   I2C1_Transaction_t imu = {0x68, &reg, 1, reading, 6, &IMU_Done};
+*   I2C1_ASYNC.Submit(&imu);
+*******************************************************************************/
+I2C1_Status_Enum_t I2C1_ASYNC_Submit(I2C1_Transaction_t *transaction)
+{
+  uint8_t next_head = (I2C1_ASYNC_Head + 1) & _I2C1_ASYNC_QUEUE_MASK;
+  uint8_t gie_state;
+  
+  if (next_head == I2C1_ASYNC_Tail){return I2C_Busy;}  //Queue full
+  
+  transaction->status = I2C_Busy;
+  I2C1_ASYNC_Queue[I2C1_ASYNC_Head] = transaction;
+  
+  /*The ISR checks Head when a transaction finishes - hold it off so the
+   *engine can not go idle between moving Head and checking Running*/
+  gie_state = INTCON0bits.GIE;
+  INTCON0bits.GIE = 0;
+  I2C1_ASYNC_Head = next_head;
+  if (!I2C1_ASYNC_Running) {
+      I2C1_ASYNC_Running = true;
+      I2C1_ASYNC_Start(transaction);
+  }
+  INTCON0bits.GIE = gie_state;
+  
+  return I2C_OK;
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Service()
+* Description: Runs the callback of each completed transaction, in the order
+* they were submitted. Called from main context - callbacks may submit new
+* transactions.
+*******************************************************************************/
+void I2C1_ASYNC_Service(void)
+{
+  I2C1_Transaction_t *transaction;
+  
+  I2C1_ASYNC_Check_Timeout();
+  
+  while (I2C1_ASYNC_Tail != I2C1_ASYNC_Active) {
+      transaction = I2C1_ASYNC_Queue[I2C1_ASYNC_Tail];
+      I2C1_ASYNC_Tail = (I2C1_ASYNC_Tail + 1) & _I2C1_ASYNC_QUEUE_MASK;
+      if (transaction->callback != NULL){transaction->callback(transaction);}
+  }
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Check_Timeout()
+* Description: Times the transaction on the bus from when Service first sees it.
+* One that overruns its timeout is abandoned - the module is reset (recovering
+* the bus if needed), the transaction completes with I2C_TIMEOUT and the queue
+* moves on.
+*******************************************************************************/
+void I2C1_ASYNC_Check_Timeout(void)
+{
+  uint32_t now;
+  uint16_t timeout_us;
+  uint8_t gie_state;
+  
+  if (!I2C1_ASYNC_Running){return;}
+  
+  now = ISR_CORE18F_SYSTEM_TIMER_GetMicros();
+  if (I2C1_ASYNC_Watch_Sequence != I2C1_ASYNC_Sequence) {
+      I2C1_ASYNC_Watch_Sequence = I2C1_ASYNC_Sequence;
+      I2C1_ASYNC_Watch_Start = now;
+      return;
+  }
+  
+  timeout_us = I2C1_ASYNC_Queue[I2C1_ASYNC_Active]->timeout_us;
+  if (timeout_us == 0){timeout_us = _I2C1_ASYNC_DEFAULT_TIMEOUT_US;}
+  if ((now - I2C1_ASYNC_Watch_Start) <= timeout_us){return;}
+  
+  gie_state = INTCON0bits.GIE;
+  INTCON0bits.GIE = 0;
+  if (I2C1_ASYNC_Running && (I2C1_ASYNC_Watch_Sequence == I2C1_ASYNC_Sequence)) {  //Did not finish while we looked
+      MASTER_I2C1_Reset();
+      I2C1_ASYNC_Result = I2C_TIMEOUT;
+      I2C1_ASYNC_Complete();
+  }
+  INTCON0bits.GIE = gie_state;
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_IsIdle()
+* Description: True when nothing is queued, on the bus or waiting for its callback.
+*******************************************************************************/
+bool I2C1_ASYNC_IsIdle(void)
+{
+  return (I2C1_ASYNC_Tail == I2C1_ASYNC_Head);
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Start()
+* Description: Loads the first phase of a transaction and sets the Start bit.
+* The byte counter, address buffer and RSEN do the framing, the interrupts only
+* move data and switch phases.
+*******************************************************************************/
+void I2C1_ASYNC_Start(I2C1_Transaction_t *transaction)
+{
+  I2C1PIR = 0;
+  I2C1ERR = 0;
+  I2C1STAT1bits.CLRBF = 1;
+  I2C1_ASYNC_Result = I2C_OK;
+  I2C1_ASYNC_Sequence++;
+  
+  if ((transaction->write_length == 0) && (transaction->read_length > 0)) {
+      I2C1_ASYNC_Start_Read(transaction);
+  }
+  else {
+      I2C1_ASYNC_Phase = I2C1_ASYNC_PHASE_WRITE;
+      I2C1_ASYNC_Index = 1;
+      I2C1CON0bits.RSEN = (transaction->read_length > 0) ? SET : CLEAR;  //Hold the bus for the read
+      I2C1CNTL = transaction->write_length;
+      I2C1ADB1 = (uint8_t)(transaction->address << 1);
+      if (transaction->write_length > 0){I2C1TXB = transaction->write_data[0];}
+      #ifdef _CORE18F_I2C1_DMA_ENABLE
+        if (transaction->write_length > 1) {
+            I2C1_DMA_Start(_I2C1_DMA_TX_CHANNEL, &transaction->write_data[1], transaction->write_length - 1, &I2C1TXB, 1, _I2C1_DMA_TX_SIRQ);
+        }
+      #else
+        PIE7bits.I2C1TXIE = (transaction->write_length > 1) ? SET : CLEAR;
+      #endif
+  }
+  
+  I2C1PIEbits.CNTIE = SET;
+  I2C1PIEbits.PCIE = SET;
+  I2C1ERRbits.NACKIE = SET;
+  I2C1ERRbits.BCLIE = SET;
+  PIE7bits.I2C1IE = SET;
+  PIE7bits.I2C1EIE = SET;
+  
+  I2C1CON0bits.S = SET;
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Start_Read()
+* Description: Loads the read phase - a Start on its own, a repeated start when
+* it follows the write phase. The module NACKs the last byte and sends the Stop.
+*******************************************************************************/
+void I2C1_ASYNC_Start_Read(I2C1_Transaction_t *transaction)
+{
+  I2C1_ASYNC_Phase = I2C1_ASYNC_PHASE_READ;
+  I2C1_ASYNC_Index = 0;
+  I2C1CON0bits.RSEN = CLEAR;
+  I2C1CNTL = transaction->read_length;
+  I2C1ADB1 = (uint8_t)((transaction->address << 1) | 0x01);
+  #ifdef _CORE18F_I2C1_DMA_ENABLE
+    I2C1_DMA_Start(_I2C1_DMA_RX_CHANNEL, &I2C1RXB, 1, transaction->read_data, transaction->read_length, _I2C1_DMA_RX_SIRQ);
+  #else
+    PIE7bits.I2C1RXIE = SET;
+  #endif
+}
+
+/******************************************************************************
+* Function : I2C1_ASYNC_Complete()
+* Description: Stores the result, releases the module interrupts and starts the
+* next queued transaction.
+*******************************************************************************/
+void I2C1_ASYNC_Complete(void)
+{
+  PIE7bits.I2C1TXIE = CLEAR;
+  PIE7bits.I2C1RXIE = CLEAR;
+  PIE7bits.I2C1IE = CLEAR;
+  PIE7bits.I2C1EIE = CLEAR;
+  I2C1PIE = 0;
+  I2C1ERR = 0;
+  I2C1CON0bits.RSEN = CLEAR;
+  #ifdef _CORE18F_I2C1_DMA_ENABLE
+    I2C1_DMA_Stop();    //Left armed if the transaction ended early
+  #endif
+  
+  I2C1_ASYNC_Queue[I2C1_ASYNC_Active]->status = I2C1_Record_Status(I2C1_ASYNC_Result);
+  I2C1_ASYNC_Active = (I2C1_ASYNC_Active + 1) & _I2C1_ASYNC_QUEUE_MASK;
+  
+  if (I2C1_ASYNC_Active != I2C1_ASYNC_Head) {
+      I2C1_ASYNC_Start(I2C1_ASYNC_Queue[I2C1_ASYNC_Active]);
+  }
+  else {
+      I2C1_ASYNC_Running = false;
+  }
+}
+
+#ifdef _CORE18F_I2C1_DMA_ENABLE
+/******************************************************************************
+* Function : I2C1_DMA_Init()
+* Description: Gives DMA1 and DMA2 bus priority over the CPU and locks the system
+* arbiter, which the DMA needs before it will run. PR1WAY is off in the config
+* bits so other drivers can still change the priorities.
+*******************************************************************************/
+void I2C1_DMA_Init(void)
+{
+  uint8_t gie_state = INTCON0bits.GIE;
+  
+  DMA1PR = 0;
+  DMA2PR = 1;
+  ISRPR = 2;
+  MAINPR = 3;
+  
+  INTCON0bits.GIE = 0;
+  PRLOCK = 0x55;      //Unlock sequence
+  PRLOCK = 0xAA;
+  PRLOCKbits.PRLOCKED = 1;
+  INTCON0bits.GIE = gie_state;
+}
+
+/******************************************************************************
+* Function : I2C1_DMA_Start()
+* Description: Arms one DMA channel to move a byte each time the trigger flag
+* sets. The side with size 1 stays fixed, the other increments. The channel
+* clears its own trigger enable when the block is done.
+*
+* Parameters:
+*   - channel (uint8_t): DMASELECT value.
+*   - source, source_size: Where the bytes come from.
+*   - destination, destination_size: Where the bytes go.
+*   - trigger (uint8_t): Interrupt vector number that starts each byte.
+*******************************************************************************/
+void I2C1_DMA_Start(uint8_t channel, volatile void *source, uint8_t source_size, volatile void *destination, uint8_t destination_size, uint8_t trigger)
+{
+  DMASELECT = channel;
+  DMAnCON0 = 0;
+  DMAnCON1bits.SMR = 0b00;                          //Source in SFR/GPR space
+  DMAnCON1bits.SMODE = (source_size > 1) ? 0b01 : 0b00;
+  DMAnCON1bits.SSTP = (source_size > 1) ? SET : CLEAR;
+  DMAnCON1bits.DMODE = (destination_size > 1) ? 0b01 : 0b00;
+  DMAnCON1bits.DSTP = (destination_size > 1) ? SET : CLEAR;
+  DMAnSSA = (uint24_t)(uint16_t)source;
+  DMAnSSZ = source_size;
+  DMAnDSA = (uint16_t)destination;
+  DMAnDSZ = destination_size;
+  DMAnSIRQ = trigger;
+  DMAnAIRQ = 0;
+  DMAnCON0bits.EN = SET;
+  DMAnCON0bits.SIRQEN = SET;
+}
+
+/******************************************************************************
+* Function : I2C1_DMA_Stop()
+* 
+*******************************************************************************/
+void I2C1_DMA_Stop(void)
+{
+  DMASELECT = _I2C1_DMA_TX_CHANNEL;
+  DMAnCON0 = 0;
+  DMASELECT = _I2C1_DMA_RX_CHANNEL;
+  DMAnCON0 = 0;
+}
+#endif
+
+/******************************************************************************
+***** Interrupt Service Routines
+*******************************************************************************/
+#ifdef _CORE18F_HAL_I2C1_ASYNC_ENABLE
+/*Transmit buffer empty - load the next write byte*/
+void __interrupt(irq(I2C1TX), base(_CORE18F_ISR_BASE_ADDRESS)) I2C1_ASYNC_TX_ISR(void)
+{
+  I2C1_Transaction_t *transaction = I2C1_ASYNC_Queue[I2C1_ASYNC_Active];
+  
+  I2C1TXB = transaction->write_data[I2C1_ASYNC_Index++];
+  if (I2C1_ASYNC_Index >= transaction->write_length){PIE7bits.I2C1TXIE = CLEAR;}
+}
+
+/*Byte received*/
+void __interrupt(irq(I2C1RX), base(_CORE18F_ISR_BASE_ADDRESS)) I2C1_ASYNC_RX_ISR(void)
+{
+  I2C1_Transaction_t *transaction = I2C1_ASYNC_Queue[I2C1_ASYNC_Active];
+  uint8_t data = I2C1RXB;
+  
+  if (I2C1_ASYNC_Index < transaction->read_length){transaction->read_data[I2C1_ASYNC_Index++] = data;}
+}
+
+/*Count reached zero or Stop sent*/
+void __interrupt(irq(I2C1), base(_CORE18F_ISR_BASE_ADDRESS)) I2C1_ASYNC_ISR(void)
+{
+  I2C1_Transaction_t *transaction = I2C1_ASYNC_Queue[I2C1_ASYNC_Active];
+  
+  if (I2C1PIRbits.CNTIF) {
+      I2C1PIRbits.CNTIF = CLEAR;
+      if ((I2C1_ASYNC_Phase == I2C1_ASYNC_PHASE_WRITE) && (transaction->read_length > 0)) {
+          I2C1_ASYNC_Start_Read(transaction);
+          I2C1CON0bits.S = SET;   //Repeated start
+      }
+  }
+  
+  if (I2C1PIRbits.PCIF) {
+      I2C1PIRbits.PCIF = CLEAR;
+      I2C1_ASYNC_Complete();
+  }
+}
+
+/*NACK or bus collision*/
+void __interrupt(irq(I2C1E), base(_CORE18F_ISR_BASE_ADDRESS)) I2C1_ASYNC_Error_ISR(void)
+{
+  I2C1_Transaction_t *transaction = I2C1_ASYNC_Queue[I2C1_ASYNC_Active];
+  
+  if (I2C1ERRbits.BCLIF) {
+      I2C1ERRbits.BCLIF = CLEAR;
+      I2C1_ASYNC_Result = I2C_BUS_COLLISION;
+      I2C1STAT1bits.CLRBF = 1;
+      I2C1_ASYNC_Complete();  //Bus lost - no Stop to wait for
+      return;
+  }
+  
+  if (I2C1ERRbits.NACKIF) {
+      I2C1ERRbits.NACKIF = CLEAR;
+      if ((I2C1_ASYNC_Phase == I2C1_ASYNC_PHASE_READ) || (I2C1CNTL == transaction->write_length)) {
+          I2C1_ASYNC_Result = I2C_ADDRESS_INVALID;
+      }
+      else {
+          I2C1_ASYNC_Result = I2C_NACK_RECEIVED;
+      }
+      I2C1_ASYNC_Phase = I2C1_ASYNC_PHASE_STOP;
+      PIE7bits.I2C1TXIE = CLEAR;
+      PIE7bits.I2C1RXIE = CLEAR;
+      I2C1CON0bits.RSEN = CLEAR;
+      if (I2C1STAT0bits.MMA){I2C1CON1bits.P = SET;}  //PCIF completes the transaction
+      else {I2C1_ASYNC_Complete();}
+  }
+}
+#endif
+
+
+/*** End of File **************************************************************/
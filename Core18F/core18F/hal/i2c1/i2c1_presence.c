@@ -0,0 +1,220 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Device Presence Cache
+* Filename              :   i2c1_presence.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "i2c1_presence.h"
+
+#ifdef _CORE18F_HAL_I2C1_PRESENCE_ENABLE
+/******************************************************************************
+* I2C1 Presence Interface
+*******************************************************************************/
+const I2C1_Presence_Interface_t I2C1_PRESENCE = {
+  .Scan = &I2C1_PRESENCE_Scan,
+  .IsPresent = &I2C1_PRESENCE_IsPresent,
+  .IsMissing = &I2C1_PRESENCE_IsMissing,
+  .Probe = &I2C1_PRESENCE_Probe,
+  .Invalidate = &I2C1_PRESENCE_Invalidate,
+  .InvalidateAll = &I2C1_PRESENCE_InvalidateAll,
+};
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+/*One bit per 7-bit address - Known says the Present bit is a real answer*/
+uint8_t I2C1_PRESENCE_Known[16];
+uint8_t I2C1_PRESENCE_Present[16];
+uint32_t I2C1_PRESENCE_Epoch;     //Millis when the cache was last emptied
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void I2C1_PRESENCE_Check_Expired(void);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : I2C1_PRESENCE_Scan()
+* Description: Probes every non-reserved address (0x08-0x77) and refreshes the
+* cache. Each probe is an address only write, so a scan of an empty bus costs
+* 112 address NACKs in the I2C1 statistics.
+*
+* Parameters:
+*   - found (uint8_t*): Addresses that answered, lowest first. NULL to only fill the cache.
+*   - max_found (uint8_t): Size of found.
+*
+* Returns:
+*   - uint8_t: Number of devices that answered, may be more than max_found.
+*
+* Example:
+*   uint8_t devices[8];
+*   uint8_t count = I2C1_PRESENCE.Scan(devices, 8);
+*******************************************************************************/
+uint8_t I2C1_PRESENCE_Scan(uint8_t *found, uint8_t max_found)
+{
+  uint8_t count = 0;
+  
+  for (uint8_t address = _I2C1_PRESENCE_FIRST_ADDRESS; address <= _I2C1_PRESENCE_LAST_ADDRESS; address++)
+  {
+      if (I2C1_PRESENCE_Probe(address)) {
+          if ((found != NULL) && (count < max_found)){found[count] = address;}
+          count++;
+      }
+  }
+  
+  return count;
+}
+
+/******************************************************************************
+* Function : I2C1_PRESENCE_IsPresent()
+* Description: Cached presence check for hot paths - only touches the bus when
+* the address has not been seen since it was invalidated or the cache expired.
+*
+* Parameters:
+*   - i2c_address (uint8_t): 7-bit address.
+*
+* Returns:
+*   - bool: true if the device answered its last probe.
+*******************************************************************************/
+bool I2C1_PRESENCE_IsPresent(uint8_t i2c_address)
+{
+  uint8_t index = (i2c_address >> 3) & 0x0F;
+  uint8_t mask = (uint8_t)(1 << (i2c_address & 0x07));
+  
+  if (i2c_address > 0x7F){return false;}
+  
+  I2C1_PRESENCE_Check_Expired();
+  
+  if (!(I2C1_PRESENCE_Known[index] & mask)){return I2C1_PRESENCE_Probe(i2c_address);}
+  
+  return ((I2C1_PRESENCE_Present[index] & mask) != 0);
+}
+
+/******************************************************************************
+* Function : I2C1_PRESENCE_IsMissing()
+* Description: Cache lookup only - never probes and never reads the timer, so
+* it is safe per byte and next to queued I2C1_ASYNC transfers. Unknown and
+* expired answers count as not missing.
+*
+* Parameters:
+*   - i2c_address (uint8_t): 7-bit address.
+*
+* Returns:
+*   - bool: true if the device failed its last probe.
+*******************************************************************************/
+bool I2C1_PRESENCE_IsMissing(uint8_t i2c_address)
+{
+  uint8_t index = (i2c_address >> 3) & 0x0F;
+  uint8_t mask = (uint8_t)(1 << (i2c_address & 0x07));
+  
+  return ((I2C1_PRESENCE_Known[index] & mask) && !(I2C1_PRESENCE_Present[index] & mask));
+}
+
+/******************************************************************************
+* Function : I2C1_PRESENCE_Probe()
+* Description: Probes the address now and caches the answer.
+*
+* Parameters:
+*   - i2c_address (uint8_t): 7-bit address.
+*
+* Returns:
+*   - bool: true if the device acknowledged its address.
+*******************************************************************************/
+bool I2C1_PRESENCE_Probe(uint8_t i2c_address)
+{
+  uint8_t index = (i2c_address >> 3) & 0x0F;
+  uint8_t mask = (uint8_t)(1 << (i2c_address & 0x07));
+  uint8_t unused = 0;
+  bool present;
+  
+  if (i2c_address > 0x7F){return false;}
+  
+  present = (I2C1_MASTER.WriteData(i2c_address, 0, &unused) == I2C_OK);
+  
+  I2C1_PRESENCE_Known[index] |= mask;
+  if (present){I2C1_PRESENCE_Present[index] |= mask;}
+  else {I2C1_PRESENCE_Present[index] &= (uint8_t)~mask;}
+  
+  return present;
+}
+
+/******************************************************************************
+* Function : I2C1_PRESENCE_Invalidate()
+* Description: Forgets the cached answer for one address - drivers call this
+* after a transfer fails so the next IsPresent() probes again.
+*
+*******************************************************************************/
+void I2C1_PRESENCE_Invalidate(uint8_t i2c_address)
+{
+  I2C1_PRESENCE_Known[(i2c_address >> 3) & 0x0F] &= (uint8_t)~(1 << (i2c_address & 0x07));
+}
+
+/******************************************************************************
+* Function : I2C1_PRESENCE_InvalidateAll()
+* Description: Empties the cache and restarts the re-probe interval.
+*
+*******************************************************************************/
+void I2C1_PRESENCE_InvalidateAll(void)
+{
+  for (uint8_t index = 0; index < sizeof(I2C1_PRESENCE_Known); index++)
+  {
+      I2C1_PRESENCE_Known[index] = 0;
+  }
+  I2C1_PRESENCE_Epoch = ISR_CORE18F_SYSTEM_TIMER_GetMillis();
+}
+
+/******************************************************************************
+* Function : I2C1_PRESENCE_Check_Expired()
+* Description: Empties the cache once _I2C1_PRESENCE_REPROBE_MS has passed.
+*
+*******************************************************************************/
+void I2C1_PRESENCE_Check_Expired(void)
+{
+  #if _I2C1_PRESENCE_REPROBE_MS > 0
+    if ((ISR_CORE18F_SYSTEM_TIMER_GetMillis() - I2C1_PRESENCE_Epoch) >= _I2C1_PRESENCE_REPROBE_MS) {
+        I2C1_PRESENCE_InvalidateAll();
+    }
+  #endif
+}
+#endif
+
+
+/*** End of File **************************************************************/
@@ -0,0 +1,272 @@
+/****************************************************************************
+* Title                 :   Core MCU I2C1 Target (Slave) Functions
+* Filename              :   i2c1_target.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "i2c1_target.h"
+
+/******************************************************************************
+* I2C1 Target Interface
+*******************************************************************************/
+const I2C1_Target_Interface_t I2C1_TARGET = {
+  .Initialize = &I2C1_TARGET_Init,
+  .IsBusy = &I2C1_TARGET_IsBusy,
+};
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+const I2C1_Target_Map_t *I2C1_TARGET_Map;
+volatile uint8_t I2C1_TARGET_Pointer;       //Register pointer, auto-increments
+volatile uint8_t I2C1_TARGET_Write_Start;   //First register of the current write
+volatile uint8_t I2C1_TARGET_Write_Count;   //Registers stored by the current write
+volatile bool I2C1_TARGET_Pointer_Next;     //Next byte received sets the pointer
+volatile bool I2C1_TARGET_Read_Started;     //on_read called for this read
+volatile bool I2C1_TARGET_TX_From_Map;      //Byte sitting in TXB came from the map
+volatile bool I2C1_TARGET_Pointer_Set;      //Pointer written during this transfer
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void I2C1_TARGET_End_Transfer(void);
+void I2C1_TARGET_Start_Read(void);
+void I2C1_TARGET_Load_TX(void);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : I2C1_TARGET_Init()
+* Description: Sets up I2C1 as a 7-bit target answering at i2c_address and
+* serving the register map. The module runs from the I2C1 interrupts - the
+* clock is only stretched while a byte is loaded or stored, and after the
+* address of a read while on_read runs and the first byte is loaded. TX
+* interrupts are only enabled from that address match to the Stop, nothing
+* is loaded while the bus is idle.
+*
+* Parameters:
+*   - i2c_address (uint8_t): 7-bit address.
+*   - map (const I2C1_Target_Map_t*): Register map, must stay valid.
+*
+* Example:
+*   uint8_t sensor_regs[8];
+*   const I2C1_Target_Map_t sensor_map = {sensor_regs, sensor_regs, 8, NULL, &Regs_Written};
+*   I2C1_TARGET.Initialize(0x42, &sensor_map);
+*******************************************************************************/
+void I2C1_TARGET_Init(uint8_t i2c_address, const I2C1_Target_Map_t *map)
+{
+    uint8_t address = (uint8_t)(i2c_address << 1);
+    
+    I2C1_TARGET_Map = map;
+    I2C1_TARGET_Pointer = 0;
+    I2C1_TARGET_Write_Count = 0;
+    I2C1_TARGET_Pointer_Next = true;
+    I2C1_TARGET_Read_Started = false;
+    I2C1_TARGET_TX_From_Map = false;
+    I2C1_TARGET_Pointer_Set = false;
+    
+    I2C1_Map_Pins();
+    
+    I2C1CON0 = 0x0; //Disabled, Client mode, 7-bit address 
+    I2C1CON1 = 0x0; //ACKDT/ACKCNT ACK every byte, CSD clock stretching enabled
+    I2C1CON2bits.SDAHT = _I2C1_SDA_HOLD;
+    I2C1CON2bits.ABD = 0; //Address goes to I2C1ADB0, RXB only sees data
+    
+    /*All four compare registers get the same address*/
+    I2C1ADR0 = address;
+    I2C1ADR1 = address;
+    I2C1ADR2 = address;
+    I2C1ADR3 = address;
+    
+    I2C1PIR = 0x0;
+    I2C1ERR = 0x0;
+    I2C1STAT1bits.CLRBF = 1;
+    
+    /*Start, Restart and Stop - none of these stretch the clock. An address
+     *match holds the clock (CSTR) until the ISR has looked at R/W*/
+    I2C1PIE = 0x0;
+    I2C1PIEbits.SCIE = SET;
+    I2C1PIEbits.RSCIE = SET;
+    I2C1PIEbits.PCIE = SET;
+    I2C1PIEbits.ADRIE = SET;
+    
+    PIE7bits.I2C1TXIE = CLEAR;   //Enabled by a read address match
+    PIE7bits.I2C1RXIE = SET;
+    PIE7bits.I2C1IE = SET;
+    
+    I2C1CON0bits.EN = SET;
+    
+    ISR_Enable_System_Default();
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_IsBusy()
+* Description: true while a host is addressing this target.
+*
+*******************************************************************************/
+bool I2C1_TARGET_IsBusy(void)
+{
+    return (I2C1STAT0bits.SMA == SET);
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_End_Transfer()
+* Description: Stop or repeated Start. Reports a finished write and steps
+* the pointer back over a read byte the host never clocked out - TX runs one
+* byte ahead of the bus. A pointer written during the transfer is kept as is.
+*
+*******************************************************************************/
+void I2C1_TARGET_End_Transfer(void)
+{
+    PIE7bits.I2C1TXIE = CLEAR;
+    
+    if (I2C1_TARGET_Write_Count > 0) {
+        if (I2C1_TARGET_Map->on_write != NULL) {
+            I2C1_TARGET_Map->on_write(I2C1_TARGET_Write_Start, I2C1_TARGET_Write_Count);
+        }
+        I2C1_TARGET_Write_Count = 0;
+    }
+    
+    if (I2C1_TARGET_Read_Started && I2C1_TARGET_TX_From_Map && !I2C1_TARGET_Pointer_Set && (I2C1STAT1bits.TXBE == CLEAR)) {
+        I2C1_TARGET_Pointer--;
+    }
+    
+    I2C1STAT1bits.CLRBF = 1;
+    I2C1_TARGET_Pointer_Next = true;
+    I2C1_TARGET_Read_Started = false;
+    I2C1_TARGET_TX_From_Map = false;
+    I2C1_TARGET_Pointer_Set = false;
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_Start_Read()
+* Description: Address match with R/W set - the clock is held, so on_read
+* sees the pointer the host just wrote and the first byte is in TXB before
+* the host clocks it.
+*
+*******************************************************************************/
+void I2C1_TARGET_Start_Read(void)
+{
+    I2C1_TARGET_Read_Started = true;
+    if (I2C1_TARGET_Map->on_read != NULL){I2C1_TARGET_Map->on_read(I2C1_TARGET_Pointer);}
+    
+    I2C1_TARGET_Load_TX();
+    PIE7bits.I2C1TXIE = SET;
+}
+
+/******************************************************************************
+* Function : I2C1_TARGET_Load_TX()
+* Description: Loads the register at the pointer, 0xFF past the end. I2C1CNT
+* is kept topped up - the count is not used to end a target read (the host
+* does that with its NACK), but TXIF is only raised while it is non-zero.
+*
+*******************************************************************************/
+void I2C1_TARGET_Load_TX(void)
+{
+    I2C1CNTH = 0xFF;
+    I2C1CNTL = 0xFF;
+    
+    if (I2C1_TARGET_Pointer < I2C1_TARGET_Map->size) {
+        I2C1TXB = I2C1_TARGET_Map->read_map[I2C1_TARGET_Pointer++];
+        I2C1_TARGET_TX_From_Map = true;
+    }
+    else {
+        I2C1TXB = 0xFF;
+        I2C1_TARGET_TX_From_Map = false;
+    }
+}
+
+/******************************************************************************
+***** Interrupt Service Routines
+*******************************************************************************/
+#ifdef _CORE18F_HAL_I2C1_TARGET_ENABLE
+/*Host is reading - the first byte went into TXB at the address match, load the next one*/
+void __interrupt(irq(I2C1TX), base(_CORE18F_ISR_BASE_ADDRESS)) I2C1_TARGET_TX_ISR(void)
+{
+    I2C1_TARGET_Load_TX();
+}
+
+/*Host wrote a byte - the first one is the register pointer*/
+void __interrupt(irq(I2C1RX), base(_CORE18F_ISR_BASE_ADDRESS)) I2C1_TARGET_RX_ISR(void)
+{
+    uint8_t data = I2C1RXB;
+    
+    if (I2C1_TARGET_Pointer_Next) {
+        I2C1_TARGET_Pointer_Next = false;
+        I2C1_TARGET_Pointer = data;
+        I2C1_TARGET_Write_Start = data;
+        I2C1_TARGET_Pointer_Set = true;
+        return;
+    }
+    
+    if ((I2C1_TARGET_Map->write_map != NULL) && (I2C1_TARGET_Pointer < I2C1_TARGET_Map->size)) {
+        I2C1_TARGET_Map->write_map[I2C1_TARGET_Pointer++] = data;
+        I2C1_TARGET_Write_Count++;
+    }
+}
+
+/*Start, repeated Start, address match or Stop - in bus order*/
+void __interrupt(irq(I2C1), base(_CORE18F_ISR_BASE_ADDRESS)) I2C1_TARGET_ISR(void)
+{
+    if (I2C1PIRbits.SCIF) {
+        I2C1PIRbits.SCIF = CLEAR;
+        I2C1_TARGET_End_Transfer();
+    }
+    
+    if (I2C1PIRbits.RSCIF) {
+        I2C1PIRbits.RSCIF = CLEAR;
+        I2C1_TARGET_End_Transfer();
+    }
+    
+    if (I2C1PIRbits.ADRIF) {
+        I2C1PIRbits.ADRIF = CLEAR;
+        if (I2C1STAT0bits.R){I2C1_TARGET_Start_Read();}
+        I2C1CON0bits.CSTR = CLEAR;  //Release the clock held since the address ACK
+    }
+    
+    if (I2C1PIRbits.PCIF) {
+        I2C1PIRbits.PCIF = CLEAR;
+        I2C1_TARGET_End_Transfer();
+    }
+}
+#endif
+
+
+/*** End of File **************************************************************/
@@ -34,6 +34,7 @@
 *
 *   Date        Version     Author          Description 
 *   2024/04/25  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  Auto-baud detection and RS-485 TXDE direction control
 *  
 *
 *****************************************************************************/
@@ -58,6 +59,9 @@ const SERIAL1_Interface_t SERIAL1 = {
     .IsTransmitBufferReady = &SERIAL1_IsTXBufferEmpty,
     .IsError = &SERIAL1_IsError,
     .ClearErrors = &SERIAL1_Clear_Error,
+    .StartAutoBaud = &SERIAL1_AutoBaud_Start,
+    .AutoBaudStatus = &SERIAL1_AutoBaud_Status,
+    .RS485_Enable = &SERIAL1_RS485_Enable,
 };
 
 /******************************************************************************
@@ -90,6 +94,10 @@ void SERIAL1_Init(SerialBaudEnum_t BaudSelect)
   
   PPS_MapOutput(_CORE18F_SERIAL1_OUTPUT_PIN,PPSOUT_UART1_TX);  //Map TX to ->Serial Out    
   
+  #ifdef _CORE18F_SERIAL1_TXDE_PIN
+  SERIAL1_RS485_Enable(_CORE18F_SERIAL1_TXDE_PIN, _CORE18F_SERIAL1_CTS_PIN);  //Hardware RS-485 direction control
+  #endif
+  
   U1CON0bits.RXEN = SERIAL1_Config[BaudSelect].RXEN_Enable; //Receive Enable
   U1CON0bits.TXEN = SERIAL1_Config[BaudSelect].TXEN_Enable; //Transmit Enable
   U1CON1bits.ON = SERIAL1_Config[BaudSelect].SPEN_Enable; //Serial Port Enable
@@ -229,4 +237,68 @@ void SERIAL1_Clear_Error(void)
   U1CON0bits.RXEN = SET;
 }
 
+/******************************************************************************
+* Function : SERIAL1_AutoBaud_Start()
+* Description: Arms auto-baud detection. The next character received must be
+* 0x55 ('U') - the UART times it and loads U1BRG itself. The character is not
+* placed in the receive FIFO. Poll SERIAL1_AutoBaud_Status() for the result.
+*******************************************************************************/
+void SERIAL1_AutoBaud_Start(void)
+{
+  U1UIRbits.ABDIF = CLEAR;
+  U1ERRIRbits.ABDOVF = CLEAR;
+  U1CON0bits.ABDEN = SET;
+}
+
+/******************************************************************************
+* Function : SERIAL1_AutoBaud_Status()
+* Description: Checks on an auto-baud detection started by SERIAL1_AutoBaud_Start().
+*
+* Returns:
+*   - SERIAL1_Status_Enum_t: OK when U1BRG has been loaded, AUTOBAUD_PENDING while
+*     waiting for the sync character or AUTOBAUD_OVERFLOW if the baud rate was
+*     too slow to measure - U1BRG is not valid, start again.
+*******************************************************************************/
+SERIAL1_Status_Enum_t SERIAL1_AutoBaud_Status(void)
+{
+  if (U1ERRIRbits.ABDOVF) {
+      U1CON0bits.ABDEN = CLEAR;
+      U1ERRIRbits.ABDOVF = CLEAR;
+      return AUTOBAUD_OVERFLOW;
+  }
+  
+  if (!U1UIRbits.ABDIF){return AUTOBAUD_PENDING;}
+  
+  U1UIRbits.ABDIF = CLEAR;  //ABDEN is cleared by hardware on completion
+  return OK;
+}
+
+/******************************************************************************
+* Function : SERIAL1_RS485_Enable()
+* Description: Maps the UART1 transmit driver enable (TXDE) output to a pin for
+* the DE input of an RS-485 transceiver. TXDE is driven high from the start bit
+* until the end of the last stop bit by the UART, so no software turnaround or
+* dead time is needed. Also called by SERIAL1_Init() when _CORE18F_SERIAL1_TXDE_PIN
+* is defined in the device config.
+*
+* TXDE is only driven with hardware flow control selected - U1CON2.FLO = 0b10
+* is set before the pin is mapped. Hardware flow control also holds transmit
+* while CTS is high, so U1CTS is mapped to CTS_Pin and that pin is driven low -
+* a spare pin, or one tied low on the board. Transmit is never gated.
+*
+* Parameters:
+*   - DE_Pin (GPIO_Ports_t): Pin connected to the transceiver DE (and /RE) input.
+*   - CTS_Pin (GPIO_Ports_t): Pin U1CTS is tied to, held low (clear to send).
+*******************************************************************************/
+void SERIAL1_RS485_Enable(GPIO_Ports_t DE_Pin, GPIO_Ports_t CTS_Pin)
+{
+  GPIO_WritePortPin(CTS_Pin, LOW);
+  GPIO_SetDirection(CTS_Pin, OUTPUT);
+  PPS_MapInput(CTS_Pin, &U1CTSPPS);  //CTS low - clear to send, always
+  
+  GPIO_WritePortPin(DE_Pin, LOW);  //Receive until the first byte is sent
+  U1CON2bits.FLO = 0b10;           //Hardware flow control - the UART drives TXDE
+  PPS_MapOutput(DE_Pin, PPSOUT_UART1_TXDE);
+}
+
 /*** End of File **************************************************************/
\ No newline at end of file
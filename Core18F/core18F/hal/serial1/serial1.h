@@ -34,6 +34,7 @@
 *
 *   Date        Version     Author          Description 
 *   2024/04/25  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.1.0       Jamie Starling  Auto-baud detection and RS-485 TXDE direction control
 *  
 *
 *****************************************************************************/
@@ -45,6 +46,10 @@
 *******************************************************************************/
 #include "../../core18F.h"
 
+#if defined(_CORE18F_SERIAL1_TXDE_PIN) && !defined(_CORE18F_SERIAL1_CTS_PIN)
+    #error "TXDE selects hardware flow control, which gates transmit on CTS - define _CORE18F_SERIAL1_CTS_PIN"
+#endif
+
 /******************************************************************************
 * Defines
 *******************************************************************************/
@@ -59,6 +64,8 @@ typedef enum
   FRAMMING_ERROR,
   OVERRUN_ERROR,
   TIMEOUT,
+  AUTOBAUD_PENDING,
+  AUTOBAUD_OVERFLOW,
 }SERIAL1_Status_Enum_t;
 
 /******************************************************************************
@@ -74,6 +81,9 @@ typedef struct {
   LogicEnum_t (*IsTransmitBufferReady)(void);  
   SERIAL1_Status_Enum_t (*IsError)(void);
   void (*ClearErrors)(void);
+  void (*StartAutoBaud)(void);
+  SERIAL1_Status_Enum_t (*AutoBaudStatus)(void);
+  void (*RS485_Enable)(GPIO_Ports_t DE_Pin, GPIO_Ports_t CTS_Pin);
 }SERIAL1_Interface_t;
 
 extern const SERIAL1_Interface_t SERIAL1;
@@ -92,6 +102,9 @@ uint8_t SERIAL1_GetReceivedData(void);
 LogicEnum_t SERIAL1_IsTXBufferEmpty(void);
 SERIAL1_Status_Enum_t SERIAL1_IsError(void);
 void SERIAL1_Clear_Error(void);
+void SERIAL1_AutoBaud_Start(void);
+SERIAL1_Status_Enum_t SERIAL1_AutoBaud_Status(void);
+void SERIAL1_RS485_Enable(GPIO_Ports_t DE_Pin, GPIO_Ports_t CTS_Pin);
 #endif /*_CORE18F_SERIAL1_H*/
 
 /*** End of File **************************************************************/
@@ -51,6 +51,10 @@
 #include "serial1.h"
 #include "../../isr/isr_control.h"
 
+#ifdef _CORE18F_MODBUS_RTU_ENABLE
+    #include "../../drivers/modbus_rtu/modbus_rtu.h"
+#endif
+
 /******************************************************************************
 ***** Functions
 *******************************************************************************/
@@ -132,7 +136,9 @@ void SERIAL1_ISR_RC_Enable(LogicEnum_t setState)
 *******************************************************************************/
 void __interrupt(irq(U1RX), base(_CORE18F_ISR_BASE_ADDRESS)) SERIAL1_RC_ISR(void)
 {
- // Unhandled interrupts go here
+#ifdef _CORE18F_MODBUS_RTU_ENABLE
+    MODBUS_RX_ISR();  //Modbus RTU frame receive
+#endif
 }
 
 void SERIAL1_ISR_Handler_RC(void (*RCIRQ_HANDLER)(uint8_t))
@@ -228,7 +234,9 @@ void SERIAL1_ISR_TX_Enable(LogicEnum_t setState)
 *******************************************************************************/
 void __interrupt(irq(U1TX), base(_CORE18F_ISR_BASE_ADDRESS)) SERIAL1_TX_ISR(void)
 {
- // Unhandled interrupts go here
+#ifdef _CORE18F_MODBUS_RTU_ENABLE
+    MODBUS_TX_ISR();  //Modbus RTU reply transmit
+#endif
 }
 
 void SERIAL1_ISR_Handler_TX(void (*TXIRQ_HANDLER)(void))
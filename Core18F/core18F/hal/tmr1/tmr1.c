@@ -39,6 +39,7 @@
 *
 *   Date        Version     Author          Description 
 *   2024/09/08  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.0.1       Jamie Starling  {FIX}Q84 PIR3/PIE3 flags, CORE_Make_16 - Added TMR1_Set_16bit_Value
 *  
 *
 *****************************************************************************/
@@ -323,7 +324,43 @@ uint8_t TMR1_Get_8bit_Value(void)
 *******************************************************************************/
 uint16_t TMR1_Get_16bit_Value(void)
 {
-  return CORE18F_Make_16(TMR1H,TMR1L);
+  return CORE_Make_16(TMR1H,TMR1L);
+}
+
+/******************************************************************************
+* Function : TMR1_Set_16bit_Value()
+*//** 
+* \b Description:
+*
+* Loads the Timer1 counter. Writing a preload of (65536 - ticks) makes Timer1
+* overflow, and set TMR1IF, after the given number of ticks.
+*
+* PRE-CONDITION:  
+*    - Timer1 should be in 16-bit read/write mode so the write to `TMR1L`
+*      also loads the buffered high byte in the same cycle.
+*
+* POST-CONDITION: 
+*    - Timer1 counts on from the new value.
+*
+* @param[in] value - The 16-bit value to load into Timer1.
+*
+* @return None
+*
+* \b Example:
+* @code
+* 	
+* TMR1_Set_16bit_Value(65536 - 1000);  //Overflow in 1000 ticks
+* 	
+* @endcode
+*
+* <br><b> - HISTORY OF CHANGES - </b>
+*  
+* <hr>
+*******************************************************************************/
+void TMR1_Set_16bit_Value(uint16_t value)
+{
+  TMR1H = (uint8_t)(value >> 8);  //Buffered until TMR1L is written in 16-bit mode
+  TMR1L = (uint8_t)value;
 }
 
 /******************************************************************************
@@ -331,7 +368,7 @@ uint16_t TMR1_Get_16bit_Value(void)
 *//** 
 * \b Description:
 *
-* This function clears the Timer1 interrupt flag (`TMR1IF`) in the `PIR4` register. 
+* This function clears the Timer1 interrupt flag (`TMR1IF`) in the `PIR3` register. 
 * The interrupt flag is set when Timer1 overflows, signaling that an interrupt has occurred. 
 * This function resets the flag to ensure that Timer1 can generate new interrupts for subsequent 
 * overflows.
@@ -371,7 +408,7 @@ uint16_t TMR1_Get_16bit_Value(void)
 *******************************************************************************/
 void TMR1_Clear_Interrupt_Flag(void)        
 {  
-  PIR4bits.TMR1IF = 0;
+  PIR3bits.TMR1IF = 0;
 }
 
 /******************************************************************************
@@ -384,7 +421,7 @@ void TMR1_Clear_Interrupt_Flag(void)
 * the event via an interrupt service routine (ISR). When disabled, Timer1 will 
 * continue counting but will not trigger any interrupts.
 *
-* The function modifies the `TMR1IE` bit in the `PIE4` register to control the interrupt.
+* The function modifies the `TMR1IE` bit in the `PIE3` register to control the interrupt.
 *
 * PRE-CONDITION:  
 *    - Timer1 must be initialized.
@@ -420,7 +457,7 @@ void TMR1_Clear_Interrupt_Flag(void)
 *******************************************************************************/
 void TMR1_Enable_Interrupt(LogicEnum_t setState)
 {
-    PIE4bits.TMR1IE = setState;
+    PIE3bits.TMR1IE = setState;
 }
 
 /******************************************************************************
@@ -469,7 +506,7 @@ void TMR1_Enable_Interrupt(LogicEnum_t setState)
 *******************************************************************************/
 LogicEnum_t TMR1_Interrupt_Flag_Set(void)
 {
-  return PIR4bits.TMR1IF;
+  return PIR3bits.TMR1IF;
 }
 
 /*** End of File **************************************************************/
@@ -40,6 +40,7 @@
 *
 *   Date        Version     Author          Description 
 *   2024/09/08  1.0.0       Jamie Starling  Initial Version
+*   2026/10/18  1.0.1       Jamie Starling  {FIX}Q84 PIR3/PIE3 flags, CORE_Make_16 - Added TMR1_Set_16bit_Value
 *  
 *
 *****************************************************************************/
@@ -60,6 +61,7 @@ void TMR1_Set_Prescaler_Rate(TMR1_PreScaler_SelectEnum_t value);
 void TMR1_Set_Clock_Source(TMR1_Clock_Source_SelectEnum_t value);
 uint8_t TMR1_Get_8bit_Value(void);
 uint16_t TMR1_Get_16bit_Value(void);
+void TMR1_Set_16bit_Value(uint16_t value);
 void TMR1_Clear_Interrupt_Flag(void);
 void TMR1_Enable_Interrupt(LogicEnum_t setState);
 LogicEnum_t TMR1_Interrupt_Flag_Set(void);
@@ -0,0 +1,508 @@
+/****************************************************************************
+* Title                 :   Core MCU UART Multi-Instance Driver
+* Filename              :   uart.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "uart.h"
+#include "../pps/pps.h"
+#include "../../isr/isr_control.h"
+
+/******************************************************************************
+***** UART Interface
+*******************************************************************************/
+const UART_Interface_t UART = {
+    .Initialize = &UART_Init,
+    .WriteByte = &UART_WriteByte,
+    .Write = &UART_Write,
+    .WriteString = &UART_WriteString,
+    .Available = &UART_Available,
+    .ReadByte = &UART_ReadByte,
+    .Read = &UART_Read,
+    .IsTransmitComplete = &UART_IsTransmitComplete,
+    .IsError = &UART_IsError,
+    .ClearErrors = &UART_ClearErrors,
+    .StartAutoBaud = &UART_AutoBaud_Start,
+    .AutoBaudStatus = &UART_AutoBaud_Status,
+    .RS485_Enable = &UART_RS485_Enable,
+};
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+/*Buffers are only allocated for ports enabled in the device config*/
+#ifdef _CORE18F_HAL_UART1_ENABLE
+UART_State_t UART1_State;
+#define _UART1_STATE &UART1_State
+#else
+#define _UART1_STATE NULL
+#endif
+
+#ifdef _CORE18F_HAL_UART2_ENABLE
+UART_State_t UART2_State;
+#define _UART2_STATE &UART2_State
+#else
+#define _UART2_STATE NULL
+#endif
+
+#ifdef _CORE18F_HAL_UART3_ENABLE
+UART_State_t UART3_State;
+#define _UART3_STATE &UART3_State
+#else
+#define _UART3_STATE NULL
+#endif
+
+#ifdef _CORE18F_HAL_UART4_ENABLE
+UART_State_t UART4_State;
+#define _UART4_STATE &UART4_State
+#else
+#define _UART4_STATE NULL
+#endif
+
+#ifdef _CORE18F_HAL_UART5_ENABLE
+UART_State_t UART5_State;
+#define _UART5_STATE &UART5_State
+#else
+#define _UART5_STATE NULL
+#endif
+
+/*Indexed by UART_Instance_t*/
+UART_State_t * const UART_State_LU[] = {
+    _UART1_STATE,
+    _UART2_STATE,
+    _UART3_STATE,
+    _UART4_STATE,
+    _UART5_STATE
+};
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void UART_RX_Service(const UART_RegisterSet_t *regs, UART_State_t *state);
+void UART_TX_Service(const UART_RegisterSet_t *regs, UART_State_t *state);
+
+/******************************************************************************
+***** Functions
+*******************************************************************************/
+/******************************************************************************
+* Function : UART_Init()
+* Description: Configures a UART for asynchronous 8N1, maps its pins and
+* starts interrupt driven receive. The port must be enabled in the device config.
+*
+* Parameters:
+*   - uart (UART_Instance_t): UART_PORT1 to UART_PORT5.
+*   - baud (uint32_t): Baud rate, BRG is calculated from _XTAL_FREQ.
+*   - rx_pin (GPIO_Ports_t): Pin mapped to the UART receive input.
+*   - tx_pin (GPIO_Ports_t): Pin mapped to the UART transmit output.
+*
+* Returns:
+*   - UART_Status_Enum_t: UART_OK, or UART_NOT_ENABLED if the port has no buffers.
+*
+* Example:
+*   UART.Initialize(UART_PORT2, 115200, PORTB_1, PORTB_0);
+*******************************************************************************/
+UART_Status_Enum_t UART_Init(UART_Instance_t uart, uint32_t baud, GPIO_Ports_t rx_pin, GPIO_Ports_t tx_pin)
+{
+  const UART_RegisterSet_t *regs = &UART_Register_LU[uart];
+  UART_State_t *state = UART_State_LU[uart];
+  uint16_t brg;
+  
+  if (state == NULL){return UART_NOT_ENABLED;}
+  
+  *(regs->pie_reg) &= ~(regs->rxie_mask | regs->txie_mask);
+  *(regs->con1_reg) = 0x00;  //Port off while it is configured
+  
+  brg = (uint16_t)((((_XTAL_FREQ / 4) + (baud / 2)) / baud) - 1);  //High speed BRG - Fosc/(4*(BRG+1))
+  *(regs->brgl_reg) = (uint8_t)brg;
+  *(regs->brgh_reg) = (uint8_t)(brg >> 8);
+  
+  *(regs->con0_reg) = _UART_CON0_BRGS | _UART_CON0_TXEN | _UART_CON0_RXEN | _UART_CON0_MODE_ASYNC_8BIT;
+  *(regs->con2_reg) = 0x00;  //Normal polarity, 1 stop bit, no flow control
+  
+  state->rx_head = 0;
+  state->rx_tail = 0;
+  state->tx_head = 0;
+  state->tx_tail = 0;
+  state->error = UART_OK;
+  
+  GPIO_SetDirection(rx_pin, INPUT);
+  PPS_MapInput(rx_pin, regs->rx_pps_reg);
+  PPS_MapOutput(tx_pin, regs->tx_pps);
+  
+  *(regs->con1_reg) = _UART_CON1_ON;
+  
+  *(regs->pie_reg) |= regs->rxie_mask;
+  ISR_Enable_System_Default();
+  return UART_OK;
+}
+
+/******************************************************************************
+* Function : UART_WriteByte()
+* Description: Queues one byte for transmit. Does not wait - the TX ISR sends
+* the queued bytes.
+*
+* Returns:
+*   - UART_Status_Enum_t: UART_OK, UART_TX_BUFFER_FULL or UART_NOT_ENABLED.
+*******************************************************************************/
+UART_Status_Enum_t UART_WriteByte(UART_Instance_t uart, uint8_t data)
+{
+  const UART_RegisterSet_t *regs = &UART_Register_LU[uart];
+  UART_State_t *state = UART_State_LU[uart];
+  uint8_t next;
+  
+  if (state == NULL){return UART_NOT_ENABLED;}
+  
+  next = (state->tx_head + 1) & _UART_TX_BUFFER_MASK;
+  if (next == state->tx_tail){return UART_TX_BUFFER_FULL;}
+  
+  state->tx_buffer[state->tx_head] = data;
+  state->tx_head = next;
+  *(regs->pie_reg) |= regs->txie_mask;  //TX ISR drains the buffer into the FIFO
+  return UART_OK;
+}
+
+/******************************************************************************
+* Function : UART_Write()
+* Description: Queues as many bytes as fit in the transmit buffer. Does not wait.
+*
+* Returns:
+*   - uint8_t: Number of bytes queued.
+*******************************************************************************/
+uint8_t UART_Write(UART_Instance_t uart, const uint8_t *data, uint8_t length)
+{
+  uint8_t count = 0;
+  
+  while ((count < length) && (UART_WriteByte(uart, data[count]) == UART_OK)){count++;}
+  return count;
+}
+
+/******************************************************************************
+* Function : UART_WriteString()
+* Description: Queues a string, waiting for buffer space when it is full.
+*
+* Returns:
+*   - UART_Status_Enum_t: UART_OK, UART_TIMEOUT or UART_NOT_ENABLED.
+*******************************************************************************/
+UART_Status_Enum_t UART_WriteString(UART_Instance_t uart, const char *string)
+{
+  UART_Status_Enum_t status;
+  uint16_t timeout_counter;
+  
+  for (; *string != '\0'; string++) {
+      timeout_counter = _UART_TIMEOUT_VALUE;
+      while ((status = UART_WriteByte(uart, (uint8_t)*string)) == UART_TX_BUFFER_FULL) {
+          if (--timeout_counter == 0){return UART_TIMEOUT;}
+      }
+      if (status != UART_OK){return status;}
+  }
+  return UART_OK;
+}
+
+/******************************************************************************
+* Function : UART_Available()
+* Description: Number of received bytes waiting in the receive buffer.
+*******************************************************************************/
+uint8_t UART_Available(UART_Instance_t uart)
+{
+  UART_State_t *state = UART_State_LU[uart];
+  
+  if (state == NULL){return 0;}
+  return (state->rx_head - state->rx_tail) & _UART_RX_BUFFER_MASK;
+}
+
+/******************************************************************************
+* Function : UART_ReadByte()
+* Description: Takes the oldest byte from the receive buffer.
+*
+* Returns:
+*   - uint8_t: Received byte, 0 if the buffer is empty - check Available() first.
+*******************************************************************************/
+uint8_t UART_ReadByte(UART_Instance_t uart)
+{
+  UART_State_t *state = UART_State_LU[uart];
+  uint8_t data;
+  
+  if ((state == NULL) || (state->rx_head == state->rx_tail)){return 0;}
+  
+  data = state->rx_buffer[state->rx_tail];
+  state->rx_tail = (state->rx_tail + 1) & _UART_RX_BUFFER_MASK;
+  return data;
+}
+
+/******************************************************************************
+* Function : UART_Read()
+* Description: Copies up to max_length received bytes. Does not wait.
+*
+* Returns:
+*   - uint8_t: Number of bytes copied.
+*******************************************************************************/
+uint8_t UART_Read(UART_Instance_t uart, uint8_t *data, uint8_t max_length)
+{
+  uint8_t count = 0;
+  
+  while ((count < max_length) && UART_Available(uart)){data[count++] = UART_ReadByte(uart);}
+  return count;
+}
+
+/******************************************************************************
+* Function : UART_IsTransmitComplete()
+* Description: Checks the buffer is empty and the last stop bit has been sent.
+*
+* Returns:
+*   - LogicEnum_t: TRUE when everything queued is on the wire.
+*******************************************************************************/
+LogicEnum_t UART_IsTransmitComplete(UART_Instance_t uart)
+{
+  UART_State_t *state = UART_State_LU[uart];
+  
+  if (state == NULL){return TRUE;}
+  if (state->tx_head != state->tx_tail){return FALSE;}
+  return (*(UART_Register_LU[uart].errir_reg) & _UART_ERRIR_TXMTIF) ? TRUE : FALSE;
+}
+
+/******************************************************************************
+* Function : UART_IsError()
+* Description: Returns the first receive error seen since the last ClearErrors.
+*
+* Returns:
+*   - UART_Status_Enum_t: UART_OK, UART_FRAMING_ERROR or UART_OVERRUN_ERROR.
+*     Overrun covers both the hardware FIFO and the receive buffer.
+*******************************************************************************/
+UART_Status_Enum_t UART_IsError(UART_Instance_t uart)
+{
+  UART_State_t *state = UART_State_LU[uart];
+  
+  if (state == NULL){return UART_NOT_ENABLED;}
+  return state->error;
+}
+
+/******************************************************************************
+* Function : UART_ClearErrors()
+* Description: Clears the recorded receive error.
+*******************************************************************************/
+void UART_ClearErrors(UART_Instance_t uart)
+{
+  UART_State_t *state = UART_State_LU[uart];
+  
+  if (state == NULL){return;}
+  *(UART_Register_LU[uart].errir_reg) &= ~_UART_ERRIR_RXFOIF;
+  state->error = UART_OK;
+}
+
+/******************************************************************************
+* Function : UART_AutoBaud_Start()
+* Description: Arms auto-baud detection - the next character received must be
+* 0x55 ('U'). The UART measures it and loads its own BRG. Poll
+* UART_AutoBaud_Status() for the result.
+*******************************************************************************/
+void UART_AutoBaud_Start(UART_Instance_t uart)
+{
+  const UART_RegisterSet_t *regs = &UART_Register_LU[uart];
+  
+  *(regs->uir_reg) &= ~_UART_UIR_ABDIF;
+  *(regs->errir_reg) &= ~_UART_ERRIR_ABDOVF;
+  *(regs->con0_reg) |= _UART_CON0_ABDEN;
+}
+
+/******************************************************************************
+* Function : UART_AutoBaud_Status()
+* Description: Checks on an auto-baud detection started by UART_AutoBaud_Start().
+*
+* Returns:
+*   - UART_Status_Enum_t: UART_OK once the BRG is loaded, UART_AUTOBAUD_PENDING
+*     while waiting or UART_AUTOBAUD_OVERFLOW if the rate was too slow to measure.
+*******************************************************************************/
+UART_Status_Enum_t UART_AutoBaud_Status(UART_Instance_t uart)
+{
+  const UART_RegisterSet_t *regs = &UART_Register_LU[uart];
+  
+  if (*(regs->errir_reg) & _UART_ERRIR_ABDOVF) {
+      *(regs->con0_reg) &= ~_UART_CON0_ABDEN;
+      *(regs->errir_reg) &= ~_UART_ERRIR_ABDOVF;
+      return UART_AUTOBAUD_OVERFLOW;
+  }
+  
+  if (!(*(regs->uir_reg) & _UART_UIR_ABDIF)){return UART_AUTOBAUD_PENDING;}
+  
+  *(regs->uir_reg) &= ~_UART_UIR_ABDIF;  //ABDEN is cleared by hardware on completion
+  return UART_OK;
+}
+
+/******************************************************************************
+* Function : UART_RS485_Enable()
+* Description: Maps the port's transmit driver enable (TXDE) output to the DE
+* pin of an RS-485 transceiver. The UART holds TXDE high until the end of the
+* last stop bit, so turnaround needs no software timing.
+*
+* TXDE is only driven with hardware flow control selected - UxCON2.FLO = 0b10
+* is set before the pin is mapped. Call after UART.Initialize(), which clears
+* UxCON2.
+*
+* Hardware flow control also holds transmit while CTS is high, and an
+* unmapped CTS reads whatever pin UxCTSPPS resets to. CTS is mapped to
+* cts_pin, which is driven low - a spare pin, or one tied low on the board.
+*
+* Parameters:
+*   - uart (UART_Instance_t): Port to use.
+*   - de_pin (GPIO_Ports_t): Pin connected to the transceiver DE (and /RE) input.
+*   - cts_pin (GPIO_Ports_t): Pin CTS is tied to, held low so transmit is never gated.
+*******************************************************************************/
+void UART_RS485_Enable(UART_Instance_t uart, GPIO_Ports_t de_pin, GPIO_Ports_t cts_pin)
+{
+  const UART_RegisterSet_t *regs = &UART_Register_LU[uart];
+  
+  GPIO_WritePortPin(cts_pin, LOW);
+  GPIO_SetDirection(cts_pin, OUTPUT);
+  PPS_MapInput(cts_pin, regs->cts_pps_reg);  //CTS low - clear to send, always
+  
+  GPIO_WritePortPin(de_pin, LOW);  //Receive until the first byte is sent
+  *(regs->con2_reg) = (uint8_t)((*(regs->con2_reg) & ~_UART_CON2_FLO_MASK) | _UART_CON2_FLO_HARDWARE);
+  PPS_MapOutput(de_pin, regs->txde_pps);
+}
+
+/******************************************************************************
+* Function : UART_RX_Service()
+* Description: Called from the RX ISR - moves the hardware FIFO into the
+* receive buffer. Bytes that do not fit are dropped and flagged as an overrun.
+*******************************************************************************/
+void UART_RX_Service(const UART_RegisterSet_t *regs, UART_State_t *state)
+{
+  uint8_t errors;
+  uint8_t data;
+  uint8_t next;
+  
+  while (!(*(regs->fifo_reg) & _UART_FIFO_RXBE)) {
+      errors = *(regs->errir_reg);  //FERIF belongs to the byte at the top of the FIFO
+      if (errors & _UART_ERRIR_RXFOIF) {
+          *(regs->errir_reg) &= ~_UART_ERRIR_RXFOIF;
+          if (state->error == UART_OK){state->error = UART_OVERRUN_ERROR;}
+      }
+      if ((errors & _UART_ERRIR_FERIF) && (state->error == UART_OK)){state->error = UART_FRAMING_ERROR;}
+      
+      data = *(regs->rxb_reg);
+      next = (state->rx_head + 1) & _UART_RX_BUFFER_MASK;
+      if (next == state->rx_tail) {
+          if (state->error == UART_OK){state->error = UART_OVERRUN_ERROR;}
+          continue;
+      }
+      state->rx_buffer[state->rx_head] = data;
+      state->rx_head = next;
+  }
+}
+
+/******************************************************************************
+* Function : UART_TX_Service()
+* Description: Called from the TX ISR - fills the hardware FIFO from the transmit
+* buffer and turns the TX interrupt off once the buffer is empty.
+*******************************************************************************/
+void UART_TX_Service(const UART_RegisterSet_t *regs, UART_State_t *state)
+{
+  while (!(*(regs->fifo_reg) & _UART_FIFO_TXBF)) {
+      if (state->tx_tail == state->tx_head) {
+          *(regs->pie_reg) &= ~(regs->txie_mask);
+          return;
+      }
+      *(regs->txb_reg) = state->tx_buffer[state->tx_tail];
+      state->tx_tail = (state->tx_tail + 1) & _UART_TX_BUFFER_MASK;
+  }
+}
+
+/******************************************************************************
+***** Interrupt Service Routines - One pair per enabled port
+*******************************************************************************/
+#ifdef _CORE18F_HAL_UART1_ENABLE
+void __interrupt(irq(U1RX), base(_CORE18F_ISR_BASE_ADDRESS)) UART1_RX_ISR(void)
+{
+  UART_RX_Service(&UART_Register_LU[UART_PORT1], &UART1_State);
+}
+
+void __interrupt(irq(U1TX), base(_CORE18F_ISR_BASE_ADDRESS)) UART1_TX_ISR(void)
+{
+  UART_TX_Service(&UART_Register_LU[UART_PORT1], &UART1_State);
+}
+#endif
+
+#ifdef _CORE18F_HAL_UART2_ENABLE
+void __interrupt(irq(U2RX), base(_CORE18F_ISR_BASE_ADDRESS)) UART2_RX_ISR(void)
+{
+  UART_RX_Service(&UART_Register_LU[UART_PORT2], &UART2_State);
+}
+
+void __interrupt(irq(U2TX), base(_CORE18F_ISR_BASE_ADDRESS)) UART2_TX_ISR(void)
+{
+  UART_TX_Service(&UART_Register_LU[UART_PORT2], &UART2_State);
+}
+#endif
+
+#ifdef _CORE18F_HAL_UART3_ENABLE
+void __interrupt(irq(U3RX), base(_CORE18F_ISR_BASE_ADDRESS)) UART3_RX_ISR(void)
+{
+  UART_RX_Service(&UART_Register_LU[UART_PORT3], &UART3_State);
+}
+
+void __interrupt(irq(U3TX), base(_CORE18F_ISR_BASE_ADDRESS)) UART3_TX_ISR(void)
+{
+  UART_TX_Service(&UART_Register_LU[UART_PORT3], &UART3_State);
+}
+#endif
+
+#ifdef _CORE18F_HAL_UART4_ENABLE
+void __interrupt(irq(U4RX), base(_CORE18F_ISR_BASE_ADDRESS)) UART4_RX_ISR(void)
+{
+  UART_RX_Service(&UART_Register_LU[UART_PORT4], &UART4_State);
+}
+
+void __interrupt(irq(U4TX), base(_CORE18F_ISR_BASE_ADDRESS)) UART4_TX_ISR(void)
+{
+  UART_TX_Service(&UART_Register_LU[UART_PORT4], &UART4_State);
+}
+#endif
+
+#ifdef _CORE18F_HAL_UART5_ENABLE
+void __interrupt(irq(U5RX), base(_CORE18F_ISR_BASE_ADDRESS)) UART5_RX_ISR(void)
+{
+  UART_RX_Service(&UART_Register_LU[UART_PORT5], &UART5_State);
+}
+
+void __interrupt(irq(U5TX), base(_CORE18F_ISR_BASE_ADDRESS)) UART5_TX_ISR(void)
+{
+  UART_TX_Service(&UART_Register_LU[UART_PORT5], &UART5_State);
+}
+#endif
+
+/*** End of File **************************************************************/
@@ -0,0 +1,159 @@
+/****************************************************************************
+* Title                 :   Core MCU UART Multi-Instance Driver
+* Filename              :   uart.h
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8
+* Target                :   Microchip PIC18F series
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/***************  CHANGE LIST *************************************************
+*
+*   Date        Version     Author          Description 
+*   2026/10/18  1.0.0       Jamie Starling  Initial Version
+*  
+*****************************************************************************/
+
+#ifndef _CORE18F_UART_H
+#define _CORE18F_UART_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "../../core18F.h"
+
+#if defined(_CORE18F_HAL_UART1_ENABLE) && defined(_CORE18F_HAL_SERIAL1_ENABLE)
+    #error "UART1 is owned by SERIAL1 - disable _CORE18F_HAL_SERIAL1_ENABLE or _CORE18F_HAL_UART1_ENABLE"
+#endif
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+/*Ring buffer sizes are per enabled port - must be a power of 2, max 128*/
+#define _UART_RX_BUFFER_SIZE 32
+#define _UART_TX_BUFFER_SIZE 32
+#define _UART_RX_BUFFER_MASK (_UART_RX_BUFFER_SIZE - 1)
+#define _UART_TX_BUFFER_MASK (_UART_TX_BUFFER_SIZE - 1)
+
+#define _UART_TIMEOUT_VALUE 60000  //WriteString wait loops for buffer space
+
+/*UxCON0*/
+#define _UART_CON0_BRGS 0x80
+#define _UART_CON0_ABDEN 0x40
+#define _UART_CON0_TXEN 0x20
+#define _UART_CON0_RXEN 0x10
+#define _UART_CON0_MODE_ASYNC_8BIT 0x00
+/*UxCON1*/
+#define _UART_CON1_ON 0x80
+/*UxCON2*/
+#define _UART_CON2_FLO_MASK 0x03
+#define _UART_CON2_FLO_HARDWARE 0x02   //Hardware flow control - drives TXDE
+/*UxFIFO*/
+#define _UART_FIFO_TXBF 0x10
+#define _UART_FIFO_RXBE 0x02
+/*UxUIR*/
+#define _UART_UIR_ABDIF 0x40
+/*UxERRIR*/
+#define _UART_ERRIR_TXMTIF 0x80
+#define _UART_ERRIR_ABDOVF 0x20
+#define _UART_ERRIR_FERIF 0x08
+#define _UART_ERRIR_RXFOIF 0x02
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+  UART_PORT1,
+  UART_PORT2,
+  UART_PORT3,
+  UART_PORT4,
+  UART_PORT5
+}UART_Instance_t;
+
+typedef enum
+{
+  UART_OK,
+  UART_NOT_ENABLED,
+  UART_TX_BUFFER_FULL,
+  UART_FRAMING_ERROR,
+  UART_OVERRUN_ERROR,
+  UART_TIMEOUT,
+  UART_AUTOBAUD_PENDING,
+  UART_AUTOBAUD_OVERFLOW
+}UART_Status_Enum_t;
+
+/*Per port state - only allocated for ports enabled in the device config*/
+typedef struct
+{
+  uint8_t rx_buffer[_UART_RX_BUFFER_SIZE];
+  uint8_t tx_buffer[_UART_TX_BUFFER_SIZE];
+  volatile uint8_t rx_head;   //Written by the RX ISR
+  volatile uint8_t rx_tail;
+  volatile uint8_t tx_head;
+  volatile uint8_t tx_tail;   //Written by the TX ISR
+  volatile UART_Status_Enum_t error;  //First error since the last ClearErrors
+}UART_State_t;
+
+/******************************************************************************
+***** UART Interface
+*******************************************************************************/
+typedef struct {
+  UART_Status_Enum_t (*Initialize)(UART_Instance_t uart, uint32_t baud, GPIO_Ports_t rx_pin, GPIO_Ports_t tx_pin);
+  UART_Status_Enum_t (*WriteByte)(UART_Instance_t uart, uint8_t data);
+  uint8_t (*Write)(UART_Instance_t uart, const uint8_t *data, uint8_t length);
+  UART_Status_Enum_t (*WriteString)(UART_Instance_t uart, const char *string);
+  uint8_t (*Available)(UART_Instance_t uart);
+  uint8_t (*ReadByte)(UART_Instance_t uart);
+  uint8_t (*Read)(UART_Instance_t uart, uint8_t *data, uint8_t max_length);
+  LogicEnum_t (*IsTransmitComplete)(UART_Instance_t uart);
+  UART_Status_Enum_t (*IsError)(UART_Instance_t uart);
+  void (*ClearErrors)(UART_Instance_t uart);
+  void (*StartAutoBaud)(UART_Instance_t uart);
+  UART_Status_Enum_t (*AutoBaudStatus)(UART_Instance_t uart);
+  void (*RS485_Enable)(UART_Instance_t uart, GPIO_Ports_t de_pin, GPIO_Ports_t cts_pin);
+}UART_Interface_t;
+
+extern const UART_Interface_t UART;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+UART_Status_Enum_t UART_Init(UART_Instance_t uart, uint32_t baud, GPIO_Ports_t rx_pin, GPIO_Ports_t tx_pin);
+UART_Status_Enum_t UART_WriteByte(UART_Instance_t uart, uint8_t data);
+uint8_t UART_Write(UART_Instance_t uart, const uint8_t *data, uint8_t length);
+UART_Status_Enum_t UART_WriteString(UART_Instance_t uart, const char *string);
+uint8_t UART_Available(UART_Instance_t uart);
+uint8_t UART_ReadByte(UART_Instance_t uart);
+uint8_t UART_Read(UART_Instance_t uart, uint8_t *data, uint8_t max_length);
+LogicEnum_t UART_IsTransmitComplete(UART_Instance_t uart);
+UART_Status_Enum_t UART_IsError(UART_Instance_t uart);
+void UART_ClearErrors(UART_Instance_t uart);
+void UART_AutoBaud_Start(UART_Instance_t uart);
+UART_Status_Enum_t UART_AutoBaud_Status(UART_Instance_t uart);
+void UART_RS485_Enable(UART_Instance_t uart, GPIO_Ports_t de_pin, GPIO_Ports_t cts_pin);
+
+#endif /*_CORE18F_UART_H*/
+
+/*** End of File **************************************************************/
@@ -51,6 +51,10 @@
 *******************************************************************************/
 #include "../core18F.h"
 
+#ifdef _CORE18F_MODBUS_RTU_ENABLE
+    #include "../drivers/modbus_rtu/modbus_rtu.h"
+#endif
+
 /******************************************************************************
 * Functions
 *******************************************************************************/
@@ -89,6 +93,13 @@ void __interrupt(irq(TMR0), base(_CORE18F_ISR_BASE_ADDRESS)) TMR0_ISR(void)
     ISR_CORE18F_SYSTEM_TIMER_ISR();  //Core8 System Timer
 #endif
 }
+
+#ifdef _CORE18F_MODBUS_RTU_ENABLE
+void __interrupt(irq(TMR1), base(_CORE18F_ISR_BASE_ADDRESS)) TMR1_ISR(void)
+{
+    MODBUS_Timer_ISR();  //Modbus RTU t3.5 frame end
+}
+#endif
     
 void __interrupt(irq(default), base(_CORE18F_ISR_BASE_ADDRESS)) DEFAULT_ISR(void)
 {
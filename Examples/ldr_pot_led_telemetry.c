@@ -0,0 +1,97 @@
+/****************************************************************************
+* Title                 :   Read LDR, POT, turn on LED and send binary telemetry.
+* Filename              :   ldr_pot_led_telemetry.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8 
+* Target                :    
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "core16F/core16F.h" //Include Core MCU Functions
+#include "core16F/drivers/telemetry/telemetry.h" //Include Telemetry Functions
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+#define TELEMETRY_ID_LDR_POT 0x01  //Message ID for the LDR/POT sample
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+/*Sent as-is - decode on the host with : telemetry_decode.py --format 1=<HHB */
+typedef struct
+{
+    uint16_t POT_Value;
+    uint16_t LDR_Value;
+    uint8_t LED_State;
+}LDR_POT_Sample_t;
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+void main(void)
+{
+    LDR_POT_Sample_t Sample;  //Sample sent each pass - 5 bytes + 4 bytes framing
+    
+    /*Setup*/
+    /*Initialize for the Core8 System   */
+    CORE.Initialize(); //
+  
+    /*Set PORTA.0 to Output*/    
+    GPIO.ModeSet(PORTA_0,OUTPUT);
+    
+    GPIO_Analog.PinSet(PORTA_1,ANA1);  /*Set PORTA.1 to Analog and Maps ANA1 Channel - Initializes Analog*/
+    GPIO_Analog.PinSet(PORTA_2,ANA2);  /*Set PORTA.2 to Analog and Maps ANA2 Channel - Initializes Analog*/
+
+    /*Initializes Serial1 to 9600 Baud
+    *On the PIC16F15313 Receive is PORTC.5 : Transmit is on PORTC.4 */
+    SERIAL1.Initialize(BAUD_9600);  //Initializes Serial1 - On the PIC16F15313 Receive is RC4
+ 
+    while(1) //Program loop
+        {      
+            GPIO_Analog.SelectChannel(ANA1); //Select Analog ANA1 Channel
+            Sample.POT_Value = GPIO_Analog.ReadChannel();  //Read Analog Value
+            
+            GPIO_Analog.SelectChannel(ANA2); //Select Analog ANA2 Channel
+            Sample.LDR_Value = GPIO_Analog.ReadChannel(); //Read Analog Value
+            
+            //Check to see if the LDR Value is Less then the set POT Value
+            Sample.LED_State = (Sample.LDR_Value <= Sample.POT_Value) ? HIGH : LOW;
+            GPIO.PinWrite(PORTA_0,Sample.LED_State);  //Light the LED if True
+            
+            //Sends the sample straight from the struct - no formatting
+            TELEMETRY.Send(TELEMETRY_ID_LDR_POT, &Sample, sizeof(Sample));
+            
+            CORE.Delay_MS(500);    //500ms Delay    
+        }/*END of Program Loop*/
+}
+
+
+
+
+/*** End of File **************************************************************/
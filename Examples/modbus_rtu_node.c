@@ -0,0 +1,109 @@
+/****************************************************************************
+* Title                 :   Modbus RTU field I/O node.
+* Filename              :   modbus_rtu_node.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8 
+* Target                :    
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "core18F/core18F.h" //Include Core MCU Functions
+#include "core18F/drivers/modbus_rtu/modbus_rtu.h" //Include Modbus RTU Slave
+/*Device config needs : _CORE18F_HAL_SERIAL1_ISR_ENABLE and _CORE18F_MODBUS_RTU_ENABLE*/
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+#define MODBUS_NODE_ADDRESS 0x11
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+MODBUS_Exception_t Refresh_Inputs(MODBUS_Table_t table, uint16_t address, uint16_t count);
+MODBUS_Exception_t Apply_Outputs(MODBUS_Table_t table, uint16_t address, uint16_t count);
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+uint8_t Coils[1];               //Coil 0 : LED on PORTA.0
+uint16_t Holding_Registers[4];  //Free for the master to use
+uint16_t Input_Registers[1];    //Input 0 : POT reading
+
+const MODBUS_Map_t Modbus_Map = {
+    .coils = Coils,
+    .coil_count = 1,
+    .holding_registers = Holding_Registers,
+    .holding_register_count = 4,
+    .input_registers = Input_Registers,
+    .input_register_count = 1,
+    .before_read = &Refresh_Inputs,
+    .after_write = &Apply_Outputs,
+};
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+void main(void)
+{
+    /*Setup*/
+    CORE.Initialize();
+  
+    GPIO.ModeSet(PORTA_0,OUTPUT);
+    GPIO_Analog.PinSet(PORTA_1,ANA1);  /*Set PORTA.1 to Analog and Maps ANA1 Channel*/
+    
+    MODBUS.Initialize(MODBUS_NODE_ADDRESS, BAUD_19200, &Modbus_Map);
+ 
+    while(1) //Program loop
+        {      
+            MODBUS.Process();  //Never blocks - other work can run here
+        }/*END of Program Loop*/
+}
+
+/*Reads the POT only when the master asks for it*/
+MODBUS_Exception_t Refresh_Inputs(MODBUS_Table_t table, uint16_t address, uint16_t count)
+{
+    if (table == MODBUS_INPUT_REGISTERS) {
+        GPIO_Analog.SelectChannel(ANA1);
+        Input_Registers[0] = GPIO_Analog.ReadChannel();
+    }
+    return MODBUS_NO_EXCEPTION;
+}
+
+/*Drives the LED from coil 0*/
+MODBUS_Exception_t Apply_Outputs(MODBUS_Table_t table, uint16_t address, uint16_t count)
+{
+    if (table == MODBUS_COILS) {
+        GPIO.PinWrite(PORTA_0, (Coils[0] & 0x01) ? HIGH : LOW);
+    }
+    return MODBUS_NO_EXCEPTION;
+}
+
+
+
+
+/*** End of File **************************************************************/
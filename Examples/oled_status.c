@@ -0,0 +1,89 @@
+/****************************************************************************
+* Title                 :   OLED status screen.
+* Filename              :   oled_status.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8 
+* Target                :   
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "core18F/core18F.h" //Include Core MCU Functions
+#include "core18F/drivers/oled_i2c/oled_i2c.h" //Include OLED Driver
+/*Device config needs : _CORE18F_HAL_I2C_ENABLE and _CORE18F_SYSTEM_EVENTS_ENABLE
+ *oled_i2c.h needs : _OLED_BACKGROUND_REFRESH_ENABLE*/
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Show_POT(void);
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+OLED_Device_t Panel = OLED_I2C_SSD1306(0x3C);
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+void main(void)
+{
+    /*Setup*/
+    CORE.Initialize();
+  
+    GPIO_Analog.PinSet(PORTA_1,ANA1);  /*Set PORTA.1 to Analog and Maps ANA1 Channel*/
+    
+    OLED.Initialize(&Panel);
+    OLED.Write(&Panel, 0, 0, "Core MCU");
+    OLED.Write(&Panel, 2, 0, "POT :");
+    OLED.Refresh_Start(&Panel);                 //Sends what changes - nothing to wait on
+    
+    CORE.Events_Add(100, &Show_POT, 100);       //Reading every 100ms
+ 
+    while(1) //Program loop
+        {      
+            CORE.Events_Check();  //Runs Show_POT and the OLED refresh
+        }/*END of Program Loop*/
+}
+
+/*Draws the POT reading right aligned - only the columns that change are sent*/
+void Show_POT(void)
+{
+    char digits[10];
+    char field[5] = "    ";   //0-4095 in 4 characters
+    uint8_t count;
+    
+    GPIO_Analog.SelectChannel(ANA1);
+    count = CORE.UintToDigits(GPIO_Analog.ReadChannel(), digits);
+    for (uint8_t i = 0; i < count; i++){field[4 - count + i] = digits[i];}
+    OLED.Write(&Panel, 2, 36, field);
+}
+
+
+
+
+/*** End of File **************************************************************/
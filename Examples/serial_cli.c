@@ -0,0 +1,112 @@
+/****************************************************************************
+* Title                 :   Control the LED and read the POT from a serial terminal.
+* Filename              :   serial_cli.c
+* Author                :   Jamie Starling
+* Origin Date           :   2026/10/18
+* Version               :   1.0.0
+* Compiler              :   XC8 
+* Target                :    
+* Copyright             :   Jamie Starling
+* All Rights Reserved
+*
+* THIS SOFTWARE IS PROVIDED BY JAMIE STARLING "AS IS" AND ANY EXPRESSED
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL JAMIE STARLING OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+*******************************************************************************/
+
+/******************************************************************************
+*                     LICENSED FOR NON-COMMERCIAL USE
+*                Visit http://jamiestarling.com/corelicense
+*                           for details 
+*******************************************************************************/
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "core16F/core16F.h" //Include Core MCU Functions
+#include "core16F/drivers/cli/cli.h" //Include Command Line Functions
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+CLI_Status_Enum_t Command_LED(uint8_t argc, char *argv[]);
+CLI_Status_Enum_t Command_POT(uint8_t argc, char *argv[]);
+void Write_Text(const char *text);
+
+/******************************************************************************
+* Constants
+*******************************************************************************/
+/*Type : led 1  |  led 0  |  pot*/
+const CLI_Command_t Commands[] = {
+    {"led", &Command_LED},
+    {"pot", &Command_POT},
+};
+
+/******************************************************************************
+* Functions
+*******************************************************************************/
+void main(void)
+{
+    /*Setup*/
+    /*Initialize for the Core8 System   */
+    CORE.Initialize(); //
+  
+    /*Set PORTA.0 to Output*/    
+    GPIO.ModeSet(PORTA_0,OUTPUT);
+    
+    GPIO_Analog.PinSet(PORTA_1,ANA1);  /*Set PORTA.1 to Analog and Maps ANA1 Channel - Initializes Analog*/
+
+    /*Initializes Serial1 to 9600 Baud
+    *On the PIC16F15313 Receive is PORTC.5 : Transmit is on PORTC.4 */
+    SERIAL1.Initialize(BAUD_9600);
+    
+    CLI.Initialize(Commands, sizeof(Commands) / sizeof(Commands[0]));
+ 
+    while(1) //Program loop
+        {      
+            CLI.Process();  //Never blocks - other work can run here
+        }/*END of Program Loop*/
+}
+
+/*led <0|1> - Turns the LED on or off*/
+CLI_Status_Enum_t Command_LED(uint8_t argc, char *argv[])
+{
+    int32_t state;
+    
+    if (argc != 2 || !CLI.ParseInt(argv[1], &state)){return CLI_BAD_ARGUMENT;}
+    
+    GPIO.PinWrite(PORTA_0, state ? HIGH : LOW);
+    return CLI_OK;
+}
+
+/*pot - Prints the POT reading*/
+CLI_Status_Enum_t Command_POT(uint8_t argc, char *argv[])
+{
+    char Buffer[12];  //Fits any int32_t
+    
+    GPIO_Analog.SelectChannel(ANA1); //Select Analog ANA1 Channel
+    CORE.IntToString(GPIO_Analog.ReadChannel(), Buffer);
+    SERIAL1.WriteString(Buffer);
+    Write_Text("\r\n");
+    return CLI_OK;
+}
+
+/*Writes a const string - SERIAL1.WriteString takes a RAM pointer*/
+void Write_Text(const char *text)
+{
+    while (*text){SERIAL1.WriteByte((uint8_t)*text++);}
+}
+
+
+
+
+/*** End of File **************************************************************/
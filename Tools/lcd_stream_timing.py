@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+Title       :   Core MCU LCD Stream Timing Check
+Filename    :   lcd_stream_timing.py
+Author      :   Jamie Starling
+Origin Date :   2026/10/18
+Version     :   1.1.0
+
+Checks the byte stream built by LCD_I2C_Stream_Put() (drivers/lcd_i2c) against
+the HD44780 write timing, for each I2C bus speed.
+
+The model:
+    - The PCF8574 updates its outputs at the ACK of each byte, so every byte
+      on the wire is one step of P0-P7, 9 bit times after the last one.
+    - Each I2C write starts with a Start and the address byte, chunks of the
+      same string are separate writes.
+    - The HD44780 latches a nibble on the EN falling edge and is busy for
+      the execute time after the second nibble of a byte.
+
+Usage:
+    lcd_stream_timing.py
+    lcd_stream_timing.py --speed 400000 --text "Hello World"
+
+LICENSED FOR NON-COMMERCIAL USE - Visit http://jamiestarling.com/corelicense
+"""
+
+import argparse
+import sys
+
+# PCF8574 wiring used by LCD_DATA_t
+RS, RW, EN, BACKLIGHT = 0x01, 0x02, 0x04, 0x08
+
+# lcd_i2c.h
+LCD_EXECUTE_TIME_US = 53
+LCD_STREAM_BUFFER_SIZE = 40
+
+# HD44780U write timing (ns) - VCC 2.7 to 4.5V column, the slower one
+T_AS = 60       # RS setup before EN rise
+PW_EH = 450     # EN high width
+T_CYC_E = 1000  # EN cycle
+T_DSW = 195     # Data setup before EN fall - met by any change a byte earlier
+T_H = 10        # Data hold after EN fall - met by any change a byte later
+
+
+def byte_time_us(speed):
+    return 9000000 // speed
+
+
+def pad_bytes(speed):
+    byte_us = byte_time_us(speed)
+    return ((LCD_EXECUTE_TIME_US + byte_us - 1) // byte_us) - 1
+
+
+def build_writes(data, rs, speed, backlight=True):
+    """Mirrors LCD_I2C_Stream_Put() and LCD_I2C_Stream_Pack(). Returns a list of I2C writes."""
+    bytes_per_char = 4 + pad_bytes(speed)
+    state = (BACKLIGHT if backlight else 0) | (RS if rs else 0)
+    writes, stream = [], []
+    for value in data:
+        if len(stream) + 1 + bytes_per_char > LCD_STREAM_BUFFER_SIZE:
+            writes.append(stream)
+            stream = []
+        if not stream:
+            stream.append(state)        # RS settled with EN low
+        for nibble in (value >> 4, value & 0x0F):
+            state = (state & 0x0F) | (nibble << 4)
+            stream.append(state | EN)
+            stream.append(state)
+        stream.extend([state] * pad_bytes(speed))
+        assert len(stream) <= LCD_STREAM_BUFFER_SIZE, "stream buffer overrun"
+    if stream:
+        writes.append(stream)
+    return writes
+
+
+def timeline(writes, speed):
+    """(time ns, output byte) for each PCF8574 update. Start + address byte ahead of each write."""
+    bit_ns = 1e9 / speed
+    events, now = [], 0.0
+    for stream in writes:
+        now += bit_ns * (1 + 9)         # Start and the address byte
+        for value in stream:
+            now += bit_ns * 9
+            events.append((now, value))
+        now += bit_ns                   # Stop
+    return events
+
+
+def check(data, rs, speed):
+    """Replays the outputs through an HD44780 model. Returns (errors, decoded bytes, time us)."""
+    events = timeline(build_writes(data, rs, speed), speed)
+    errors, decoded = [], []
+    previous, nibbles = events[0][1], []
+    last_rise = last_fall = busy_until = -1e12
+    for when, value in events[1:]:
+        changed = previous ^ value
+        if changed & EN and value & EN:                       # EN rise
+            if changed & RS:
+                errors.append("%.0fns: RS changed with the EN rise" % when)
+            if when < busy_until:
+                errors.append("%.0fns: EN rise %.0fns before the controller is ready" % (when, busy_until - when))
+            if when - last_rise < T_CYC_E:
+                errors.append("%.0fns: EN cycle %.0fns" % (when, when - last_rise))
+            last_rise = when
+        elif changed & EN:                                    # EN fall - latch
+            if when - last_rise < PW_EH:
+                errors.append("%.0fns: EN high %.0fns" % (when, when - last_rise))
+            if changed & 0xF0:
+                errors.append("%.0fns: data changed with the EN fall" % when)
+            # Setup and hold are a whole byte time (9us or more) unless they change together
+            last_fall = when
+            nibbles.append(previous >> 4)
+            if len(nibbles) == 2:
+                decoded.append((nibbles[0] << 4) | nibbles[1])
+                nibbles = []
+                busy_until = when + LCD_EXECUTE_TIME_US * 1000
+        previous = value
+    return errors, decoded, events[-1][0] / 1000
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check LCD stream mode against HD44780 timing")
+    parser.add_argument("--speed", type=int, action="append", help="I2C bus speed in Hz (default 100k, 400k and 1M)")
+    parser.add_argument("--text", default="0123456789ABCDEFGHIJ", help="Characters to stream")
+    args = parser.parse_args()
+
+    failed = False
+    for speed in args.speed or [100000, 400000, 1000000]:
+        data = args.text.encode("ascii")
+        errors, decoded, total_us = check(data, True, speed)
+        if decoded != list(data):
+            errors.append("decoded %r" % bytes(decoded))
+        print("%7d Hz : pad %d, %d writes, %.0fus for %d characters - %s" % (
+            speed, pad_bytes(speed), len(build_writes(data, True, speed)), total_us, len(data),
+            "OK" if not errors else "%d errors" % len(errors)))
+        for error in errors[:10]:
+            print("    " + error)
+        failed |= bool(errors)
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
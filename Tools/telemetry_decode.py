@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+Title       :   Core MCU Telemetry Decoder
+Filename    :   telemetry_decode.py
+Author      :   Jamie Starling
+Origin Date :   2026/10/18
+Version     :   1.0.0
+
+Host side decoder for frames sent by drivers/telemetry (TELEMETRY.Send).
+
+Frame on the wire:
+    COBS( [Message ID] [Payload] [CRC16 High] [CRC16 Low] ) 0x00
+
+CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over ID + Payload.
+Payloads are raw little endian structs as laid out by XC8.
+
+Usage:
+    telemetry_decode.py --port /dev/ttyUSB0 --baud 9600 --format 1=<HH
+    telemetry_decode.py --file capture.bin
+
+--format maps a message ID to a Python struct format so payloads are printed
+as values instead of hex. Serial ports need pyserial (pip install pyserial).
+
+LICENSED FOR NON-COMMERCIAL USE - Visit http://jamiestarling.com/corelicense
+"""
+
+import argparse
+import struct
+import sys
+
+FRAME_DELIMITER = 0x00
+CRC16_INIT = 0xFFFF
+
+
+def crc16_ccitt(data, crc=CRC16_INIT):
+    """CRC-16/CCITT-FALSE, matches TELEMETRY_CRC16_Update()."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(encoded):
+    """Decodes one COBS frame (without the delimiter). Returns None if malformed."""
+    decoded = bytearray()
+    index = 0
+    while index < len(encoded):
+        code = encoded[index]
+        if code == 0 or index + code > len(encoded):
+            return None
+        block = encoded[index + 1:index + code]
+        if len(block) != code - 1 or FRAME_DELIMITER in block:
+            return None
+        decoded += block
+        index += code
+        if code < 0xFF and index < len(encoded):
+            decoded.append(0)
+    return bytes(decoded)
+
+
+class TelemetryDecoder:
+    """Feed raw bytes in, get (message_id, payload) tuples out."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.crc_errors = 0
+        self.framing_errors = 0
+
+    def feed(self, data):
+        frames = []
+        for byte in data:
+            if byte != FRAME_DELIMITER:
+                self.buffer.append(byte)
+                continue
+            if self.buffer:
+                frame = self._decode_frame(bytes(self.buffer))
+                if frame is not None:
+                    frames.append(frame)
+            self.buffer.clear()
+        return frames
+
+    def _decode_frame(self, encoded):
+        raw = cobs_decode(encoded)
+        if raw is None or len(raw) < 3:
+            self.framing_errors += 1
+            return None
+        body, received_crc = raw[:-2], (raw[-2] << 8) | raw[-1]
+        if crc16_ccitt(body) != received_crc:
+            self.crc_errors += 1
+            return None
+        return body[0], body[1:]
+
+
+def parse_formats(format_args):
+    formats = {}
+    for item in format_args:
+        message_id, fmt = item.split("=", 1)
+        formats[int(message_id, 0)] = fmt
+    return formats
+
+
+def format_payload(message_id, payload, formats):
+    fmt = formats.get(message_id)
+    if fmt is not None and struct.calcsize(fmt) == len(payload):
+        return " ".join(str(value) for value in struct.unpack(fmt, payload))
+    return payload.hex(" ")
+
+
+def open_source(args):
+    if args.port:
+        import serial  # pyserial
+        port = serial.Serial(args.port, args.baud, timeout=0.1)
+        return lambda: port.read(256)
+    stream = open(args.file, "rb") if args.file else sys.stdin.buffer
+    return lambda: stream.read(256)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode Core MCU COBS/CRC16 telemetry frames")
+    parser.add_argument("--port", help="Serial port to read from")
+    parser.add_argument("--baud", type=int, default=9600, help="Baud rate (default 9600)")
+    parser.add_argument("--file", help="Read a raw capture instead of a serial port (default stdin)")
+    parser.add_argument("--format", action="append", default=[], metavar="ID=FMT",
+                        help="struct format for a message ID, e.g. 1=<HH")
+    args = parser.parse_args()
+
+    formats = parse_formats(args.format)
+    decoder = TelemetryDecoder()
+    read = open_source(args)
+
+    try:
+        while True:
+            data = read()
+            if not data:
+                if args.port:
+                    continue
+                break
+            for message_id, payload in decoder.feed(data):
+                print("ID 0x%02X : %s" % (message_id, format_payload(message_id, payload, formats)))
+    except KeyboardInterrupt:
+        pass
+
+    if decoder.crc_errors or decoder.framing_errors:
+        print("CRC errors: %d  Framing errors: %d" % (decoder.crc_errors, decoder.framing_errors),
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()